@@ -19,11 +19,36 @@
 #include <daw/daw_character_traits.h>
 #include <daw/daw_string_view.h>
 
+#include <cstddef>
 #include <cstdio>
+#include <iterator>
 
 namespace daw::json {
 	inline namespace DAW_JSON_VER {
+		/// @brief A writable output that only counts the bytes written to it.
+		/// Serializing to it gives the exact size of the output, see to_json_size
+		struct json_output_size_counter {
+			std::size_t size = 0;
+		};
+
 		namespace concepts {
+			/// @brief Specialization for json_output_size_counter
+			template<>
+			struct writable_output_trait<json_output_size_counter>
+			  : std::true_type {
+
+				template<typename... StringViews>
+				static constexpr void write( json_output_size_counter &out,
+				                             StringViews const &...svs ) {
+					static_assert( sizeof...( StringViews ) > 0 );
+					out.size += ( std::size( svs ) + ... );
+				}
+
+				static constexpr void put( json_output_size_counter &out, char ) {
+					++out.size;
+				}
+			};
+
 			/// @brief Specialization for character pointer
 			template<typename T>
 			DAW_JSON_REQUIRES(
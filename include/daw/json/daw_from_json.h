@@ -12,6 +12,7 @@
 
 #include "daw_from_json_fwd.h"
 #include "impl/daw_json_parse_class.h"
+#include "impl/daw_json_parse_into.h"
 #include "impl/daw_json_parse_value.h"
 #include "impl/daw_json_value.h"
 
@@ -52,6 +53,10 @@ namespace daw::json {
 			using json_member = json_details::json_deduced_type<JsonMember>;
 			using ParsePolicy =
 			  BasicParsePolicy<options::parse_flags_t<PolicyFlags...>::value>;
+			static_assert(
+			  not ParsePolicy::unescape_in_place or
+			    json_details::is_mutable_string_v<String>,
+			  "options::UnescapeInPlace requires a mutable buffer" );
 
 			/// If the string is known to have a trailing zero, allow optimization on
 			/// that
@@ -66,7 +71,10 @@ namespace daw::json {
 			if( first != last and last[-1] == 0 ) {
 				--last;
 			}
+			auto const structural_index =
+			  json_details::make_structural_index<ParseState>( first, last );
 			auto parse_state = ParseState( first, last );
+			json_details::attach_structural_index( parse_state, structural_index );
 
 			if constexpr( ParseState::must_verify_end_of_data_is_valid ) {
 				auto result =
@@ -100,6 +108,80 @@ namespace daw::json {
 			                                           options::parse_flags<> );
 		}
 
+		/// @brief Parse the JSON document argument into an existing value.
+		/// Strings and vectors keep their capacity and classes mapped with
+		/// json_member_list whose to_json_data returns references to their members
+		/// are parsed member by member.  Other values are parsed and assigned.
+		/// @tparam T any type with a JSON mapping
+		/// @param value The value to parse into
+		/// @param json_data JSON string data
+		/// @throws daw::json::json_exception
+		template<typename T, typename String, auto... PolicyFlags>
+		constexpr void from_json_into( T &value, String &&json_data,
+		                               options::parse_flags_t<PolicyFlags...> ) {
+			static_assert(
+			  json_details::is_string_view_like_v<String>,
+			  "String type must have a be a contiguous range of Characters" );
+			daw_json_ensure( std::data( json_data ) != nullptr,
+			                 ErrorReason::EmptyJSONDocument );
+			daw_json_ensure( std::size( json_data ) != 0,
+			                 ErrorReason::EmptyJSONDocument );
+
+			static_assert(
+			  json_details::has_json_deduced_type_v<T>,
+			  "Missing specialization of daw::json::json_data_contract for class "
+			  "mapping or specialization of daw::json::json_link_basic_type_map" );
+			using json_member = json_details::json_deduced_type<T>;
+			static_assert(
+			  std::is_same_v<json_details::json_result_t<json_member>, T>,
+			  "The mapping of T must parse to T" );
+			using ParsePolicy =
+			  BasicParsePolicy<options::parse_flags_t<PolicyFlags...>::value>;
+			static_assert(
+			  not ParsePolicy::unescape_in_place or
+			    json_details::is_mutable_string_v<String>,
+			  "options::UnescapeInPlace requires a mutable buffer" );
+
+			using policy_zstring_t = json_details::apply_zstring_policy_option_t<
+			  ParsePolicy, String, options::ZeroTerminatedString::yes>;
+
+			using ParseState =
+			  daw::conditional_t<policy_zstring_t::is_default_parse_policy,
+			                     DefaultParsePolicy, policy_zstring_t>;
+			auto first = std::data( json_data );
+			auto last = daw::data_end( json_data );
+			if( first != last and last[-1] == 0 ) {
+				--last;
+			}
+			auto const structural_index =
+			  json_details::make_structural_index<ParseState>( first, last );
+			auto parse_state = ParseState( first, last );
+			json_details::attach_structural_index( parse_state, structural_index );
+
+			json_details::parse_value_into<json_member>( parse_state, value );
+			if constexpr( ParseState::must_verify_end_of_data_is_valid ) {
+				parse_state.trim_left( );
+				daw_json_ensure( parse_state.empty( ), ErrorReason::InvalidEndOfValue,
+				                 parse_state );
+			}
+		}
+
+		/// @brief Parse the JSON document argument into an existing value.
+		/// Strings and vectors keep their capacity and classes mapped with
+		/// json_member_list whose to_json_data returns references to their members
+		/// are parsed member by member.  Other values are parsed and assigned.
+		/// @tparam T any type with a JSON mapping
+		/// @param value The value to parse into
+		/// @param json_data JSON string data
+		/// @throws daw::json::json_exception
+		template<typename T, typename String>
+		constexpr void from_json_into( T &value, String &&json_data ) {
+			static_assert(
+			  json_details::is_string_view_like_v<String>,
+			  "String type must have a be a contiguous range of Characters" );
+			from_json_into( value, DAW_FWD( json_data ), options::parse_flags<> );
+		}
+
 		/// @brief Construct the JSONMember from the JSON document argument.
 		/// @tparam JsonMember any bool, arithmetic, string, string_view,
 		/// daw::json::json_data_contract
@@ -134,13 +216,20 @@ namespace daw::json {
 
 			using ParsePolicy =
 			  BasicParsePolicy<options::parse_flags_t<PolicyFlags...>::value>;
+			static_assert(
+			  not ParsePolicy::unescape_in_place or
+			    json_details::is_mutable_string_v<String>,
+			  "options::UnescapeInPlace requires a mutable buffer" );
 
 			/// @brief If the string is known to have a trailing zero, allow
 			/// optimization on that
 			using ParseState = json_details::apply_zstring_policy_option_t<
 			  ParsePolicy, String, options::ZeroTerminatedString::yes>;
 
+			auto const structural_index =
+			  json_details::make_structural_index<ParseState>( f, l );
 			auto parse_state = ParseState::with_allocator( f, l, a );
+			json_details::attach_structural_index( parse_state, structural_index );
 			if constexpr( ParseState::must_verify_end_of_data_is_valid ) {
 				auto result =
 				  json_details::parse_value<json_member, KnownBounds,
@@ -209,6 +298,10 @@ namespace daw::json {
 
 			using ParsePolicy =
 			  BasicParsePolicy<options::parse_flags_t<PolicyFlags...>::value>;
+			static_assert(
+			  not ParsePolicy::unescape_in_place or
+			    json_details::is_mutable_string_v<String>,
+			  "options::UnescapeInPlace requires a mutable buffer" );
 
 			/// @brief If the string is known to have a trailing zero, allow
 			/// optimization on that
@@ -234,7 +327,10 @@ namespace daw::json {
 			} else {
 				daw_json_ensure( jv, ErrorReason::JSONPathNotFound );
 			}
+			auto const structural_index =
+			  json_details::make_structural_index<ParseState>( first, last );
 			auto parse_state = jv.get_raw_state( );
+			json_details::attach_structural_index( parse_state, structural_index );
 			if constexpr( ParseState::must_verify_end_of_data_is_valid ) {
 				auto result =
 				  json_details::parse_value<json_member, KnownBounds,
@@ -306,6 +402,10 @@ namespace daw::json {
 
 			using ParsePolicy =
 			  BasicParsePolicy<options::parse_flags_t<PolicyFlags...>::value>;
+			static_assert(
+			  not ParsePolicy::unescape_in_place or
+			    json_details::is_mutable_string_v<String>,
+			  "options::UnescapeInPlace requires a mutable buffer" );
 
 			/// @brief If the string is known to have a trailing zero, allow
 			/// optimization on that
@@ -329,7 +429,10 @@ namespace daw::json {
 			} else {
 				daw_json_ensure( jv, ErrorReason::JSONPathNotFound );
 			}
+			auto const structural_index =
+			  json_details::make_structural_index<ParseState>( first, last );
 			auto parse_state = jv.get_raw_state( );
+			json_details::attach_structural_index( parse_state, structural_index );
 			if constexpr( ParseState::must_verify_end_of_data_is_valid ) {
 				auto result =
 				  json_details::parse_value<json_member, KnownBounds,
@@ -387,6 +490,9 @@ namespace daw::json {
 			  "mapping or specialization of daw::json::json_link_basic_type_map" );
 			using ParsePolicy = typename BasicParsePolicy<
 			  P, Allocator>::template SetPolicyOptions<PolicyFlags...>;
+			static_assert( not ParsePolicy::unescape_in_place,
+			               "options::UnescapeInPlace is not supported by "
+			               "json_value" );
 			using ParseState =
 			  daw::conditional_t<ParsePolicy::is_default_parse_policy,
 			                     DefaultParsePolicy, ParsePolicy>;
@@ -440,6 +546,9 @@ namespace daw::json {
 			  "mapping or specialization of daw::json::json_link_basic_type_map" );
 			using ParsePolicy =
 			  BasicParsePolicy<options::parse_flags_t<PolicyFlags...>::value>;
+			static_assert( not ParsePolicy::unescape_in_place,
+			               "options::UnescapeInPlace is not supported by "
+			               "json_value" );
 			auto const old_parse_state = value.get_raw_state( );
 			using ParseState =
 			  daw::conditional_t<ParsePolicy::is_default_parse_policy,
@@ -519,6 +628,10 @@ namespace daw::json {
 
 			using ParsePolicy =
 			  BasicParsePolicy<options::parse_flags_t<PolicyFlags...>::value>;
+			static_assert(
+			  not ParsePolicy::unescape_in_place or
+			    json_details::is_mutable_string_v<String>,
+			  "options::UnescapeInPlace requires a mutable buffer" );
 
 			/// @brief If the string is known to have a trailing zero, allow
 			/// optimization on that
@@ -528,8 +641,11 @@ namespace daw::json {
 			using ParseState =
 			  daw::conditional_t<policy_zstring_t::is_default_parse_policy,
 			                     DefaultParsePolicy, policy_zstring_t>;
+			auto const structural_index = json_details::make_structural_index<
+			  ParseState>( std::data( json_data ), daw::data_end( json_data ) );
 			auto parse_state =
 			  ParseState{ std::data( json_data ), daw::data_end( json_data ) };
+			json_details::attach_structural_index( parse_state, structural_index );
 
 			parse_state.trim_left_unchecked( );
 #if defined( DAW_JSON_BUGFIX_FROM_JSON_001 )
@@ -613,6 +729,10 @@ namespace daw::json {
 
 			using ParsePolicy =
 			  BasicParsePolicy<options::parse_flags_t<PolicyFlags...>::value>;
+			static_assert(
+			  not ParsePolicy::unescape_in_place or
+			    json_details::is_mutable_string_v<String>,
+			  "options::UnescapeInPlace requires a mutable buffer" );
 
 			/// @brief If the string is known to have a trailing zero, allow
 			/// optimization on that
@@ -638,7 +758,10 @@ namespace daw::json {
 			} else {
 				daw_json_ensure( jv, ErrorReason::JSONPathNotFound );
 			}
+			auto const structural_index =
+			  json_details::make_structural_index<ParseState>( first, last );
 			auto parse_state = jv.get_raw_state( );
+			json_details::attach_structural_index( parse_state, structural_index );
 			parse_state.trim_left_unchecked( );
 #if defined( DAW_JSON_BUGFIX_FROM_JSON_001 )
 			daw_json_ensure( parse_state.is_opening_bracket_checked( ),
@@ -0,0 +1,348 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#pragma once
+
+#include "impl/version.h"
+
+#include "daw_json_link.h"
+
+#include <daw/daw_move.h>
+#include <daw/stdinc/move_fwd_exch.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <new>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+namespace daw::json {
+	inline namespace DAW_JSON_VER {
+		/***
+		 * Counters kept by json_arena.  They are reset by release( )
+		 */
+		struct json_arena_stats {
+			/// Number of allocations served by the arena
+			std::size_t allocation_count = 0;
+			/// Bytes handed out by the arena, including freed ones
+			std::size_t bytes_allocated = 0;
+			/// Bytes allocated and not yet deallocated
+			std::size_t live_bytes = 0;
+			/// The high water mark of live_bytes
+			std::size_t peak_live_bytes = 0;
+			/// Number of heap allocations made by the arena
+			std::size_t block_count = 0;
+			/// Bytes currently held by the arena's blocks
+			std::size_t bytes_reserved = 0;
+		};
+
+		/***
+		 * A monotonic arena.  Memory is taken from large blocks and only returned
+		 * to the heap by release( ) or the destructor.  Deallocating the most
+		 * recent allocation gives its space back, so a growing std::vector can
+		 * reuse it.  Use it with json_arena_allocator or from_json_arena.  It is
+		 * not thread safe.
+		 */
+		class json_arena {
+			struct alignas( std::max_align_t ) block_header {
+				block_header *prev;
+				std::size_t size;
+			};
+
+			block_header *m_head = nullptr;
+			unsigned char *m_ptr = nullptr;
+			unsigned char *m_end = nullptr;
+			std::size_t m_next_block_size;
+			json_arena_stats m_stats{ };
+
+			void add_block( std::size_t min_size ) {
+				std::size_t size = m_next_block_size;
+				if( size < min_size + sizeof( block_header ) ) {
+					size = min_size + sizeof( block_header );
+				}
+				auto *blk = static_cast<block_header *>( ::operator new( size ) );
+				blk->prev = m_head;
+				blk->size = size;
+				m_head = blk;
+				m_ptr = reinterpret_cast<unsigned char *>( blk + 1 );
+				m_end = reinterpret_cast<unsigned char *>( blk ) + size;
+				m_next_block_size = size * 2U;
+				++m_stats.block_count;
+				m_stats.bytes_reserved += size;
+			}
+
+			[[nodiscard]] static unsigned char *align_up( unsigned char *ptr,
+			                                              std::size_t alignment ) {
+				auto const p = reinterpret_cast<std::uintptr_t>( ptr );
+				auto const aligned = ( p + ( alignment - 1U ) ) &
+				                     ~static_cast<std::uintptr_t>( alignment - 1U );
+				return ptr + ( aligned - p );
+			}
+
+		public:
+			static constexpr std::size_t default_block_size = 64U * 1024U;
+
+			explicit json_arena( std::size_t initial_block_size = default_block_size )
+			  : m_next_block_size( initial_block_size ) {}
+
+			json_arena( json_arena const & ) = delete;
+			json_arena &operator=( json_arena const & ) = delete;
+
+			json_arena( json_arena &&other ) noexcept
+			  : m_head( std::exchange( other.m_head, nullptr ) )
+			  , m_ptr( std::exchange( other.m_ptr, nullptr ) )
+			  , m_end( std::exchange( other.m_end, nullptr ) )
+			  , m_next_block_size( other.m_next_block_size )
+			  , m_stats( std::exchange( other.m_stats, json_arena_stats{ } ) ) {}
+
+			json_arena &operator=( json_arena && ) = delete;
+
+			~json_arena( ) {
+				while( m_head != nullptr ) {
+					auto *prev = m_head->prev;
+					::operator delete( m_head );
+					m_head = prev;
+				}
+			}
+
+			[[nodiscard]] void *allocate( std::size_t size, std::size_t alignment ) {
+				unsigned char *p = nullptr;
+				if( m_ptr != nullptr ) {
+					p = align_up( m_ptr, alignment );
+				}
+				if( p == nullptr or p > m_end or
+				    static_cast<std::size_t>( m_end - p ) < size ) {
+					add_block( size + alignment );
+					p = align_up( m_ptr, alignment );
+				}
+				m_ptr = p + size;
+				++m_stats.allocation_count;
+				m_stats.bytes_allocated += size;
+				m_stats.live_bytes += size;
+				if( m_stats.live_bytes > m_stats.peak_live_bytes ) {
+					m_stats.peak_live_bytes = m_stats.live_bytes;
+				}
+				return p;
+			}
+
+			void deallocate( void *ptr, std::size_t size ) noexcept {
+				m_stats.live_bytes -= size;
+				auto *p = static_cast<unsigned char *>( ptr );
+				if( p + size == m_ptr ) {
+					// The most recent allocation can be reused
+					m_ptr = p;
+				}
+			}
+
+			/// @brief Free every block except the newest, which is the largest,
+			/// and reset the counters.  Everything allocated from the arena must no
+			/// longer be in use
+			void release( ) noexcept {
+				if( m_head == nullptr ) {
+					m_stats = json_arena_stats{ };
+					return;
+				}
+				while( m_head->prev != nullptr ) {
+					auto *prev = m_head->prev;
+					m_head->prev = prev->prev;
+					::operator delete( prev );
+				}
+				m_ptr = reinterpret_cast<unsigned char *>( m_head + 1 );
+				m_stats = json_arena_stats{ };
+				m_stats.block_count = 1;
+				m_stats.bytes_reserved = m_head->size;
+			}
+
+			[[nodiscard]] json_arena_stats const &stats( ) const noexcept {
+				return m_stats;
+			}
+		};
+
+		/***
+		 * An allocator that takes its memory from a json_arena.  A default
+		 * constructed allocator uses the heap.
+		 */
+		template<typename T>
+		class json_arena_allocator {
+			json_arena *m_arena = nullptr;
+
+			template<typename>
+			friend class json_arena_allocator;
+
+		public:
+			using value_type = T;
+			using propagate_on_container_copy_assignment = std::true_type;
+			using propagate_on_container_move_assignment = std::true_type;
+			using propagate_on_container_swap = std::true_type;
+
+			json_arena_allocator( ) = default;
+
+			explicit constexpr json_arena_allocator( json_arena &arena ) noexcept
+			  : m_arena( &arena ) {}
+
+			template<typename U>
+			constexpr json_arena_allocator(
+			  json_arena_allocator<U> const &other ) noexcept
+			  : m_arena( other.m_arena ) {}
+
+			[[nodiscard]] T *allocate( std::size_t n ) {
+				if( m_arena == nullptr ) {
+					return static_cast<T *>( ::operator new( n * sizeof( T ) ) );
+				}
+				return static_cast<T *>(
+				  m_arena->allocate( n * sizeof( T ), alignof( T ) ) );
+			}
+
+			void deallocate( T *ptr, std::size_t n ) noexcept {
+				if( m_arena == nullptr ) {
+					::operator delete( ptr );
+					return;
+				}
+				m_arena->deallocate( ptr, n * sizeof( T ) );
+			}
+
+			[[nodiscard]] constexpr json_arena *arena( ) const noexcept {
+				return m_arena;
+			}
+
+			template<typename U>
+			[[nodiscard]] constexpr bool
+			operator==( json_arena_allocator<U> const &rhs ) const noexcept {
+				return m_arena == rhs.m_arena;
+			}
+
+			template<typename U>
+			[[nodiscard]] constexpr bool
+			operator!=( json_arena_allocator<U> const &rhs ) const noexcept {
+				return m_arena != rhs.m_arena;
+			}
+		};
+
+		/// Containers that allocate from a json_arena.
+		template<typename T>
+		using json_arena_vector = std::vector<T, json_arena_allocator<T>>;
+
+		using json_arena_string =
+		  std::basic_string<char, std::char_traits<char>,
+		                    json_arena_allocator<char>>;
+
+		template<typename Key, typename T, typename Compare = std::less<Key>>
+		using json_arena_map =
+		  std::map<Key, T, Compare, json_arena_allocator<std::pair<Key const, T>>>;
+
+		/// std::hash is not specialized for strings with other allocators before
+		/// C++20, so hash them as a std::string_view
+		template<typename Key>
+		struct json_arena_hash : std::hash<Key> {};
+
+		template<typename CharT, typename Traits, typename Alloc>
+		struct json_arena_hash<std::basic_string<CharT, Traits, Alloc>> {
+			[[nodiscard]] std::size_t
+			operator( )( std::basic_string<CharT, Traits, Alloc> const &str ) const
+			  noexcept {
+				return std::hash<std::basic_string_view<CharT, Traits>>{ }(
+				  std::basic_string_view<CharT, Traits>( str.data( ), str.size( ) ) );
+			}
+		};
+
+		template<typename Key, typename T, typename Hash = json_arena_hash<Key>,
+		         typename KeyEqual = std::equal_to<Key>>
+		using json_arena_unordered_map =
+		  std::unordered_map<Key, T, Hash, KeyEqual,
+		                     json_arena_allocator<std::pair<Key const, T>>>;
+
+		/// @brief Construct the JSONMember from the JSON document argument.
+		/// Containers in the result that use json_arena_allocator, e.g.
+		/// json_arena_vector and json_arena_string, allocate from arena.
+		/// @tparam JsonMember any bool, arithmetic, string, string_view,
+		/// daw::json::json_data_contract
+		/// @param json_data JSON string data
+		/// @param arena The arena to allocate from.  It must outlive the result
+		/// @tparam KnownBounds The bounds of the json_data are known to contain the
+		/// whole value
+		/// @return A reified T constructed from JSON data
+		/// @throws daw::json::json_exception
+		template<typename JsonMember, bool KnownBounds = false, typename String,
+		         auto... PolicyFlags>
+		[[nodiscard]] auto from_json_arena( String &&json_data, json_arena &arena,
+		                                    options::parse_flags_t<PolicyFlags...>
+		                                      flags ) {
+			return from_json_alloc<JsonMember, KnownBounds>(
+			  DAW_FWD( json_data ), json_arena_allocator<char>( arena ), flags );
+		}
+
+		/// @brief Construct the JSONMember from the JSON document argument.
+		/// Containers in the result that use json_arena_allocator, e.g.
+		/// json_arena_vector and json_arena_string, allocate from arena.
+		/// @tparam JsonMember any bool, arithmetic, string, string_view,
+		/// daw::json::json_data_contract
+		/// @param json_data JSON string data
+		/// @param arena The arena to allocate from.  It must outlive the result
+		/// @tparam KnownBounds The bounds of the json_data are known to contain the
+		/// whole value
+		/// @return A reified T constructed from JSON data
+		/// @throws daw::json::json_exception
+		template<typename JsonMember, bool KnownBounds = false, typename String>
+		[[nodiscard]] auto from_json_arena( String &&json_data,
+		                                    json_arena &arena ) {
+			return from_json_arena<JsonMember, KnownBounds>(
+			  DAW_FWD( json_data ), arena, options::parse_flags<> );
+		}
+
+		/// @brief Parse a JSONMember from the json_data starting at member_path.
+		/// Containers in the result that use json_arena_allocator allocate from
+		/// arena.
+		/// @tparam JsonMember The type of the item being parsed
+		/// @param json_data JSON string data
+		/// @param member_path A dot separated path of member names, default is the
+		/// root.  Array indices are specified with square brackets e.g. [5] is the
+		/// 6th item
+		/// @param arena The arena to allocate from.  It must outlive the result
+		/// @tparam KnownBounds The bounds of the json_data are known to contain the
+		/// whole value
+		/// @return A value reified from the JSON data member
+		/// @throws daw::json::json_exception
+		template<typename JsonMember, bool KnownBounds = false, typename String,
+		         auto... PolicyFlags>
+		[[nodiscard]] auto from_json_arena( String &&json_data,
+		                                    std::string_view member_path,
+		                                    json_arena &arena,
+		                                    options::parse_flags_t<PolicyFlags...>
+		                                      flags ) {
+			return from_json_alloc<JsonMember, KnownBounds>(
+			  DAW_FWD( json_data ), member_path, json_arena_allocator<char>( arena ),
+			  flags );
+		}
+
+		/// @brief Parse a JSONMember from the json_data starting at member_path.
+		/// Containers in the result that use json_arena_allocator allocate from
+		/// arena.
+		/// @tparam JsonMember The type of the item being parsed
+		/// @param json_data JSON string data
+		/// @param member_path A dot separated path of member names, default is the
+		/// root.  Array indices are specified with square brackets e.g. [5] is the
+		/// 6th item
+		/// @param arena The arena to allocate from.  It must outlive the result
+		/// @tparam KnownBounds The bounds of the json_data are known to contain the
+		/// whole value
+		/// @return A value reified from the JSON data member
+		/// @throws daw::json::json_exception
+		template<typename JsonMember, bool KnownBounds = false, typename String>
+		[[nodiscard]] auto from_json_arena( String &&json_data,
+		                                    std::string_view member_path,
+		                                    json_arena &arena ) {
+			return from_json_arena<JsonMember, KnownBounds>(
+			  DAW_FWD( json_data ), member_path, arena, options::parse_flags<> );
+		}
+	} // namespace DAW_JSON_VER
+} // namespace daw::json
@@ -0,0 +1,389 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#pragma once
+
+#include "impl/version.h"
+
+#include "daw_json_lines_parallel.h"
+#include "impl/daw_json_assert.h"
+#include "impl/daw_json_link_types_fwd.h"
+#include "impl/daw_json_parse_class.h"
+#include "impl/daw_json_parse_name.h"
+
+#include <daw/daw_string_view.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <exception>
+#include <vector>
+
+namespace daw::json {
+	inline namespace DAW_JSON_VER {
+		/// @brief Options for parallel_from_json_array
+		struct json_array_parallel_options {
+			/// Number of threads to parse with, including the calling thread.  0 uses
+			/// std::thread::hardware_concurrency( )
+			std::size_t thread_count = 0;
+			/// The array is split into up to thread_count * partitions_per_thread
+			/// ranges.  Threads take the next range when they finish one
+			std::size_t partitions_per_thread = 4;
+			/// Arrays are not split into ranges smaller than this many bytes
+			std::size_t min_partition_size = 256U * 1024U;
+		};
+
+		namespace json_details {
+			[[nodiscard]] inline char const *skip_array_ws( char const *first,
+			                                                char const *last ) {
+				while( first < last and
+				       static_cast<unsigned char>( *first ) <= 0x20U ) {
+					++first;
+				}
+				return first;
+			}
+
+			[[nodiscard]] constexpr bool is_array_number_start( char c ) {
+				return c == '-' or ( c >= '0' and c <= '9' );
+			}
+
+			/***
+			 * How the elements of a homogeneous array start, taken from the first
+			 * element.  It is used to guess where elements start in the middle of
+			 * the array
+			 */
+			struct json_array_element_signature {
+				char opener = 0;
+				/// The quoted name of the first member when the elements are
+				/// classes.  Only whitespace or one of ,:}] can follow a closing
+				/// quote, so a comma, brace and this name cannot be inside a string
+				daw::string_view first_name{ };
+			};
+
+			[[nodiscard]] inline json_array_element_signature
+			make_array_element_signature( char const *first, char const *last ) {
+				auto result = json_array_element_signature{ *first, { } };
+				if( *first != '{' ) {
+					return result;
+				}
+				char const *const name_first = skip_array_ws( first + 1, last );
+				if( name_first == last or *name_first != '"' ) {
+					return result;
+				}
+				char const *name_last = name_first + 1;
+				while( name_last < last and *name_last != '"' and
+				       *name_last != '\\' ) {
+					++name_last;
+				}
+				if( name_last == last or *name_last != '"' or
+				    name_last == name_first + 1 ) {
+					return result;
+				}
+				switch( name_first[1] ) {
+				case ',':
+				case ':':
+				case '}':
+				case ']':
+					return result;
+				default:
+					if( static_cast<unsigned char>( name_first[1] ) <= 0x20U ) {
+						return result;
+					}
+				}
+				result.first_name = daw::string_view(
+				  name_first, static_cast<std::size_t>( name_last + 1 - name_first ) );
+				return result;
+			}
+
+			[[nodiscard]] inline bool
+			is_array_element_start( json_array_element_signature const &sig,
+			                        char const *first, char const *last ) {
+				char const c = *first;
+				if( is_array_number_start( sig.opener ) ) {
+					return is_array_number_start( c );
+				}
+				if( sig.opener == 't' or sig.opener == 'f' ) {
+					return c == 't' or c == 'f';
+				}
+				if( c != sig.opener ) {
+					return false;
+				}
+				if( sig.first_name.empty( ) ) {
+					return true;
+				}
+				char const *const name = skip_array_ws( first + 1, last );
+				auto const name_size = std::size( sig.first_name );
+				if( static_cast<std::size_t>( last - name ) < name_size or
+				    std::memcmp( name, std::data( sig.first_name ), name_size ) !=
+				      0 ) {
+					return false;
+				}
+				char const *const colon = skip_array_ws( name + name_size, last );
+				return colon < last and *colon == ':';
+			}
+
+			/// @brief Guess the start of the first element after a comma in
+			/// [first, last).  The element itself may extend to array_last
+			/// @return The guessed element start or nullptr
+			[[nodiscard]] inline char const *
+			find_array_element_start( json_array_element_signature const &sig,
+			                          char const *first, char const *last,
+			                          char const *array_last ) {
+				while( first < last ) {
+					auto const *comma = static_cast<char const *>( std::memchr(
+					  first, ',', static_cast<std::size_t>( last - first ) ) );
+					if( comma == nullptr ) {
+						return nullptr;
+					}
+					char const *const start = skip_array_ws( comma + 1, array_last );
+					if( start < array_last and
+					    is_array_element_start( sig, start, array_last ) ) {
+						return start;
+					}
+					first = comma + 1;
+				}
+				return nullptr;
+			}
+
+			/// The elements parsed from one range of the array
+			template<typename T>
+			struct json_array_chunk {
+				/// Where parsing started.  For all but the first range it is a guess
+				char const *first = nullptr;
+				/// Where parsing stopped, the start of the next range's first element
+				/// when the guesses were right
+				char const *stop = nullptr;
+				bool is_array_end = false;
+				std::vector<T> values{ };
+#if defined( DAW_USE_EXCEPTIONS )
+				std::exception_ptr error{ };
+#endif
+			};
+
+			/***
+			 * Parse the elements starting at first until an element starts at or
+			 * after bound, or the end of the array is found
+			 */
+			template<typename ElementType, typename ParseState, typename T>
+			void parse_json_array_chunk( json_array_chunk<T> &chunk,
+			                             char const *first, char const *bound,
+			                             char const *doc_last ) {
+				chunk.values.clear( );
+				chunk.is_array_end = false;
+				auto parse_state = ParseState( first, doc_last );
+				parse_state.trim_left( );
+				while( parse_state.first < bound ) {
+					daw_json_ensure( parse_state.has_more( ),
+					                 ErrorReason::UnexpectedEndOfData, parse_state );
+					if( parse_state.front( ) == ']' ) {
+						chunk.is_array_end = true;
+						break;
+					}
+					chunk.values.push_back(
+					  parse_value<ElementType, false, ElementType::expected_type>(
+					    parse_state ) );
+					parse_state.trim_left( );
+					daw_json_assert_weak( parse_state.has_more( ) and
+					                        parse_state.is_at_next_array_element( ),
+					                      ErrorReason::UnexpectedEndOfData, parse_state );
+					bool const is_comma = parse_state.front( ) == ',';
+					parse_state.move_next_member_or_end( );
+					// An element must follow each comma, as in from_json
+					if( is_comma and parse_state.has_more( ) ) {
+						daw_json_ensure( parse_state.front( ) != ']',
+						                 ErrorReason::TrailingComma, parse_state );
+					}
+				}
+				chunk.stop = parse_state.first;
+			}
+		} // namespace json_details
+
+		/***
+		 * @brief Parse a large JSON array of homogeneous elements on multiple
+		 * threads.  The array is split at guessed element starts, found from
+		 * the shape of the first element, and each range is parsed on its own
+		 * thread up to the next guess.  The ranges are then joined in order.
+		 * When a range did not start where the previous one stopped, the guess
+		 * was wrong and that range is parsed again from the right place on the
+		 * calling thread.
+		 * @tparam JsonElement The type of each element
+		 * @param json_data The JSON document
+		 * @param start_path The path to the array in the document
+		 * @param opts The thread count and partitioning to use
+		 * @return A vector of the elements in document order
+		 * @throws daw::json::json_exception The first error in document order
+		 * @note Without exceptions a wrong guess cannot be recovered from, so the
+		 * array is parsed on the calling thread
+		 */
+		template<typename JsonElement, auto... PolicyFlags>
+		[[nodiscard]] std::vector<
+		  json_details::json_result_t<json_details::json_deduced_type<JsonElement>>>
+		parallel_from_json_array(
+		  daw::string_view json_data, daw::string_view start_path,
+		  json_array_parallel_options const &opts =
+		    json_array_parallel_options{ } ) {
+			using element_type = json_details::json_deduced_type<JsonElement>;
+			static_assert( not std::is_same_v<element_type, void>,
+			               "Unknown JsonElement type." );
+			using value_type = json_details::json_result_t<element_type>;
+			using ParseState = TryDefaultParsePolicy<BasicParsePolicy<
+			  options::details::make_parse_flags<PolicyFlags...>( ).value>>;
+			// A range that is parsed again would decode its strings twice
+			static_assert( not ParseState::unescape_in_place,
+			               "options::UnescapeInPlace is not supported by "
+			               "parallel_from_json_array" );
+			using chunk_t = json_details::json_array_chunk<value_type>;
+
+			auto [parse_state, is_found] =
+			  json_details::find_range<ParseState>( json_data, start_path );
+			daw_json_ensure( is_found, ErrorReason::JSONPathNotFound );
+			parse_state.trim_left( );
+			daw_json_ensure( parse_state.is_opening_bracket_checked( ),
+			                 ErrorReason::InvalidArrayStart, parse_state );
+			char const *const doc_last = parse_state.last;
+			// The ranges are spread over the array, [body_first, array_last)
+			char const *array_last = doc_last;
+			if( start_path.empty( ) ) {
+				while( array_last > parse_state.first and
+				       static_cast<unsigned char>( array_last[-1] ) <= 0x20U ) {
+					--array_last;
+				}
+			} else {
+				auto array_state = parse_state;
+				array_last = array_state.skip_array( ).last;
+			}
+			parse_state.remove_prefix( );
+			parse_state.trim_left( );
+			daw_json_ensure( parse_state.has_more( ),
+			                 ErrorReason::UnexpectedEndOfData, parse_state );
+			char const *const body_first = parse_state.first;
+			if( *body_first == ']' ) {
+				return std::vector<value_type>( );
+			}
+
+#if defined( DAW_USE_EXCEPTIONS )
+			auto const thread_count =
+			  json_details::parallel_thread_count( opts.thread_count );
+			auto const body_size =
+			  static_cast<std::size_t>( array_last - body_first );
+			std::size_t const partition_count = std::min(
+			  thread_count * std::max( opts.partitions_per_thread, std::size_t{ 1 } ),
+			  body_size / std::max( opts.min_partition_size, std::size_t{ 1 } ) );
+			if( partition_count > 1 ) {
+				// Parsing from a wrong guess must fail safely, even when the input is
+				// not checked otherwise
+				using SpeculativeParseState = TryDefaultParsePolicy<
+				  BasicParsePolicy<options::details::make_parse_flags<
+				    PolicyFlags..., options::CheckedParseMode::yes>( ).value>>;
+				auto chunks = std::vector<chunk_t>( partition_count );
+				auto const sig =
+				  json_details::make_array_element_signature( body_first, array_last );
+				auto const guess = [&]( std::size_t index ) {
+					return body_first + body_size * index / partition_count;
+				};
+				json_details::run_jsonl_partitions(
+				  thread_count, partition_count,
+				  [&]( std::size_t, std::size_t index ) {
+					  chunks[index].first =
+					    index == 0 ? body_first
+					               : json_details::find_array_element_start(
+					                   sig, guess( index ), guess( index + 1 ),
+					                   array_last );
+				  } );
+
+				// Each range is parsed up to the start of the next range with a guess
+				auto bounds = std::vector<char const *>( partition_count, doc_last );
+				char const *bound = doc_last;
+				for( std::size_t n = partition_count; n-- > 0; ) {
+					bounds[n] = bound;
+					if( chunks[n].first != nullptr ) {
+						bound = chunks[n].first;
+					}
+				}
+				json_details::run_jsonl_partitions(
+				  thread_count, partition_count,
+				  [&]( std::size_t, std::size_t index ) {
+					  auto &chunk = chunks[index];
+					  if( chunk.first == nullptr ) {
+						  return;
+					  }
+					  if( index == 0 ) {
+						  json_details::parse_json_array_chunk<element_type, ParseState>(
+						    chunk, chunk.first, bounds[index], doc_last );
+						  return;
+					  }
+					  try {
+						  json_details::parse_json_array_chunk<element_type,
+						                                       SpeculativeParseState>(
+						    chunk, chunk.first, bounds[index], doc_last );
+					  } catch( ... ) {
+						  // Only an error if the guess turns out to be right
+						  chunk.error = std::current_exception( );
+					  }
+				  } );
+
+				// Join the ranges in order, the first is always right
+				char const *expected = body_first;
+				bool is_array_end = false;
+				for( std::size_t n = 0; n < partition_count; ++n ) {
+					auto &chunk = chunks[n];
+					if( is_array_end ) {
+						chunk.values.clear( );
+						continue;
+					}
+					if( chunk.first == nullptr ) {
+						continue;
+					}
+					if( chunk.first != expected ) {
+						chunk.first = expected;
+						json_details::parse_json_array_chunk<element_type, ParseState>(
+						  chunk, expected, bounds[n], doc_last );
+					} else if( chunk.error ) {
+						std::rethrow_exception( chunk.error );
+					}
+					expected = chunk.stop;
+					is_array_end = chunk.is_array_end;
+				}
+				daw_json_ensure( is_array_end, ErrorReason::UnexpectedEndOfData );
+				return json_details::merge_jsonl_buffers<value_type>(
+				  chunks, []( chunk_t &c ) -> std::vector<value_type> & {
+					  return c.values;
+				  } );
+			}
+#else
+			(void)opts;
+			(void)array_last;
+#endif
+			auto chunk = chunk_t{ };
+			json_details::parse_json_array_chunk<element_type, ParseState>(
+			  chunk, body_first, doc_last, doc_last );
+			daw_json_ensure( chunk.is_array_end, ErrorReason::UnexpectedEndOfData );
+			return std::move( chunk.values );
+		}
+
+		/***
+		 * @brief Parse a large top level JSON array of homogeneous elements on
+		 * multiple threads
+		 * @tparam JsonElement The type of each element
+		 * @param json_data The JSON array document
+		 * @param opts The thread count and partitioning to use
+		 * @return A vector of the elements in document order
+		 * @throws daw::json::json_exception The first error in document order
+		 */
+		template<typename JsonElement, auto... PolicyFlags>
+		[[nodiscard]] std::vector<
+		  json_details::json_result_t<json_details::json_deduced_type<JsonElement>>>
+		parallel_from_json_array(
+		  daw::string_view json_data,
+		  json_array_parallel_options const &opts =
+		    json_array_parallel_options{ } ) {
+			return parallel_from_json_array<JsonElement, PolicyFlags...>(
+			  json_data, daw::string_view( ), opts );
+		}
+	} // namespace DAW_JSON_VER
+} // namespace daw::json
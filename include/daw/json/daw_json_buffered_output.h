@@ -0,0 +1,247 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#pragma once
+
+#include "impl/version.h"
+
+#include "concepts/daw_writable_output_fwd.h"
+#include "impl/daw_json_assert.h"
+
+#include <daw/daw_likely.h>
+
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#if defined( __unix__ ) or defined( __APPLE__ )
+#define DAW_JSON_HAS_FD_STREAMS
+#include <cerrno>
+#include <sys/uio.h>
+#include <unistd.h>
+#endif
+
+namespace daw::json {
+	inline namespace DAW_JSON_VER {
+		/***
+		 * @brief A writable output that collects the serializer's writes in a
+		 * buffer and writes it to a FILE * or file descriptor when it is full.
+		 * Writes that do not fit are sent with the buffer in one writev call on
+		 * a file descriptor.
+		 * @note The buffer is flushed by the destructor, but errors there are
+		 * ignored.  Call flush( ) to have them reported
+		 */
+		class json_buffered_output {
+			std::FILE *m_file = nullptr;
+			std::unique_ptr<char[]> m_buffer{ };
+			std::size_t m_capacity = 0;
+			std::size_t m_size = 0;
+#if defined( DAW_JSON_HAS_FD_STREAMS )
+			int m_fd = -1;
+#endif
+
+#if defined( DAW_JSON_HAS_FD_STREAMS )
+			/// Write all of the pieces, continuing after partial writes
+			[[nodiscard]] bool write_pieces( ::iovec *first, int count ) {
+				while( count > 0 ) {
+					auto written = ::writev( m_fd, first, count );
+					if( written < 0 ) {
+						if( errno == EINTR ) {
+							continue;
+						}
+						return false;
+					}
+					while( count > 0 and
+					       static_cast<std::size_t>( written ) >= first->iov_len ) {
+						written -= static_cast<decltype( written )>( first->iov_len );
+						++first;
+						--count;
+					}
+					if( count > 0 ) {
+						first->iov_base = static_cast<char *>( first->iov_base ) + written;
+						first->iov_len -= static_cast<std::size_t>( written );
+					}
+				}
+				return true;
+			}
+#endif
+
+			[[nodiscard]] bool write_data( char const *data, std::size_t size ) {
+#if defined( DAW_JSON_HAS_FD_STREAMS )
+				if( m_fd >= 0 ) {
+					auto piece = ::iovec{ const_cast<char *>( data ), size };
+					return write_pieces( &piece, 1 );
+				}
+#endif
+				return std::fwrite( data, 1, size, m_file ) == size;
+			}
+
+			[[nodiscard]] bool flush_buffer( ) {
+				if( m_size == 0 ) {
+					return true;
+				}
+				auto const size = std::exchange( m_size, 0 );
+				return write_data( m_buffer.get( ), size );
+			}
+
+			template<typename StringView>
+			void append( StringView const &sv ) {
+				if( std::empty( sv ) ) {
+					return;
+				}
+				std::memcpy( m_buffer.get( ) + m_size, std::data( sv ),
+				             std::size( sv ) );
+				m_size += std::size( sv );
+			}
+
+			template<typename... StringViews>
+			void write_large( StringViews const &...svs ) {
+#if defined( DAW_JSON_HAS_FD_STREAMS )
+				if( m_fd >= 0 ) {
+					// The buffer and the pieces are written in one system call
+					::iovec pieces[sizeof...( StringViews ) + 1];
+					int count = 0;
+					if( m_size > 0 ) {
+						pieces[count++] = ::iovec{ m_buffer.get( ), m_size };
+					}
+					auto const add_piece = [&]( auto const &sv ) {
+						if( not std::empty( sv ) ) {
+							pieces[count++] = ::iovec{
+							  const_cast<char *>(
+							    reinterpret_cast<char const *>( std::data( sv ) ) ),
+							  std::size( sv ) };
+						}
+					};
+					( add_piece( svs ), ... );
+					m_size = 0;
+					daw_json_ensure( write_pieces( pieces, count ),
+					                 ErrorReason::OutputError );
+					return;
+				}
+#endif
+				daw_json_ensure( flush_buffer( ), ErrorReason::OutputError );
+				auto const write_piece = [&]( auto const &sv ) {
+					if( std::size( sv ) <= m_capacity - m_size ) {
+						append( sv );
+					} else {
+						daw_json_ensure( flush_buffer( ), ErrorReason::OutputError );
+						daw_json_ensure(
+						  write_data( reinterpret_cast<char const *>( std::data( sv ) ),
+						              std::size( sv ) ),
+						  ErrorReason::OutputError );
+					}
+				};
+				( write_piece( svs ), ... );
+			}
+
+		public:
+			static constexpr std::size_t default_buffer_size = 1024U * 1024U;
+
+			/// @param file An open file that is not closed.  Writes to it with
+			/// fwrite, in buffer sized blocks
+			/// @param buffer_size The size of the buffer
+			explicit json_buffered_output(
+			  std::FILE *file, std::size_t buffer_size = default_buffer_size )
+			  : m_file( file )
+			  , m_buffer( std::make_unique<char[]>( buffer_size ) )
+			  , m_capacity( buffer_size ) {
+				daw_json_ensure( file != nullptr and buffer_size > 0,
+				                 ErrorReason::OutputError );
+			}
+
+#if defined( DAW_JSON_HAS_FD_STREAMS )
+			/// @param fd An open file descriptor that is not closed.  Writes to it
+			/// with writev
+			/// @param buffer_size The size of the buffer
+			explicit json_buffered_output(
+			  int fd, std::size_t buffer_size = default_buffer_size )
+			  : m_buffer( std::make_unique<char[]>( buffer_size ) )
+			  , m_capacity( buffer_size )
+			  , m_fd( fd ) {
+				daw_json_ensure( fd >= 0 and buffer_size > 0,
+				                 ErrorReason::OutputError );
+			}
+#endif
+
+			json_buffered_output( json_buffered_output &&other ) noexcept
+			  : m_file( std::exchange( other.m_file, nullptr ) )
+			  , m_buffer( std::move( other.m_buffer ) )
+			  , m_capacity( std::exchange( other.m_capacity, 0 ) )
+			  , m_size( std::exchange( other.m_size, 0 ) )
+#if defined( DAW_JSON_HAS_FD_STREAMS )
+			  , m_fd( std::exchange( other.m_fd, -1 ) )
+#endif
+			{
+			}
+
+			json_buffered_output( json_buffered_output const & ) = delete;
+			json_buffered_output &operator=( json_buffered_output const & ) = delete;
+			json_buffered_output &operator=( json_buffered_output && ) = delete;
+
+			~json_buffered_output( ) {
+				if( m_buffer ) {
+					(void)flush_buffer( );
+				}
+			}
+
+			/// @brief Write the buffered data.  A FILE * is also flushed
+			/// @throws json_exception with ErrorReason::OutputError
+			void flush( ) {
+				daw_json_ensure( flush_buffer( ), ErrorReason::OutputError );
+				if( m_file != nullptr ) {
+					daw_json_ensure( std::fflush( m_file ) == 0,
+					                 ErrorReason::OutputError );
+				}
+			}
+
+			template<typename... StringViews>
+			void write( StringViews const &...svs ) {
+				static_assert( sizeof...( StringViews ) > 0 );
+				auto const total_size = ( std::size( svs ) + ... );
+				if( DAW_LIKELY( total_size <= m_capacity - m_size ) ) {
+					( append( svs ), ... );
+					return;
+				}
+				write_large( svs... );
+			}
+
+			void put( char c ) {
+				if( DAW_UNLIKELY( m_size == m_capacity ) ) {
+					daw_json_ensure( flush_buffer( ), ErrorReason::OutputError );
+				}
+				m_buffer[m_size++] = c;
+			}
+
+			/// @brief The number of bytes waiting to be written
+			[[nodiscard]] std::size_t buffered_size( ) const {
+				return m_size;
+			}
+		};
+
+		namespace concepts {
+			/// @brief Specialization for json_buffered_output
+			template<>
+			struct writable_output_trait<json_buffered_output> : std::true_type {
+
+				template<typename... StringViews>
+				static inline void write( json_buffered_output &out,
+				                          StringViews const &...svs ) {
+					out.write( svs... );
+				}
+
+				static inline void put( json_buffered_output &out, char c ) {
+					out.put( c );
+				}
+			};
+		} // namespace concepts
+	} // namespace DAW_JSON_VER
+} // namespace daw::json
@@ -87,7 +87,9 @@ namespace daw::json {
 			ExpectedTokenNotFound,
 			UnexpectedJSONVariantType,
 			TrailingComma,
-			AttemptToCallOpStarOnConstIterator
+			AttemptToCallOpStarOnConstIterator,
+			UnableToOpenFile,
+			UnableToReadFile
 		};
 
 		constexpr std::string_view reason_message( ErrorReason er ) {
@@ -189,6 +191,10 @@ namespace daw::json {
 				return "Trailing comma"sv;
 			case ErrorReason::AttemptToCallOpStarOnConstIterator:
 				return "Use of operator*( ) on const iterator";
+			case ErrorReason::UnableToOpenFile:
+				return "Unable to open or map the file"sv;
+			case ErrorReason::UnableToReadFile:
+				return "Unable to read from the file"sv;
 			}
 			DAW_UNREACHABLE( );
 		}
@@ -0,0 +1,299 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#pragma once
+
+#include "impl/version.h"
+
+#include "daw_from_json.h"
+#include "daw_json_iterator.h"
+#include "daw_json_lines_iterator.h"
+#include "impl/daw_json_assert.h"
+
+#include <daw/daw_string_view.h>
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#if defined( __unix__ ) or defined( __APPLE__ )
+#define DAW_JSON_HAS_MMAP
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#else
+#include <fstream>
+#endif
+
+namespace daw::json {
+	inline namespace DAW_JSON_VER {
+		/***
+		 * @brief A read only view of a whole file.  On POSIX systems the file is
+		 * memory mapped and read on demand, elsewhere it is read into memory.
+		 * Moving a json_mapped_file does not move the data, string_views into it
+		 * stay valid until it is destroyed.
+		 * @note A mapped file must not be truncated while it is in use
+		 */
+		class json_mapped_file {
+			char const *m_data = nullptr;
+			std::size_t m_size = 0;
+			bool m_is_zero_terminated = false;
+
+			void reset( ) noexcept {
+#if defined( DAW_JSON_HAS_MMAP )
+				if( m_data != nullptr ) {
+					::munmap( const_cast<char *>( m_data ), m_size );
+				}
+#else
+				delete[] m_data;
+#endif
+				m_data = nullptr;
+				m_size = 0;
+				m_is_zero_terminated = false;
+			}
+
+		public:
+			json_mapped_file( ) = default;
+
+			/***
+			 * @param path The file to open
+			 * @param populate Read the whole file when it is mapped instead of as
+			 * it is accessed(MAP_POPULATE).  This suits documents that are parsed
+			 * in full
+			 * @throws json_exception with ErrorReason::UnableToOpenFile
+			 */
+			explicit json_mapped_file( std::string const &path,
+			                           bool populate = false ) {
+#if defined( DAW_JSON_HAS_MMAP )
+				int const fd = ::open( path.c_str( ), O_RDONLY );
+				daw_json_ensure( fd >= 0, ErrorReason::UnableToOpenFile );
+				struct stat st { };
+				if( ::fstat( fd, &st ) != 0 or st.st_size < 0 ) {
+					::close( fd );
+					daw_json_error( ErrorReason::UnableToOpenFile );
+				}
+				if( st.st_size == 0 ) {
+					::close( fd );
+					return;
+				}
+				auto const size = static_cast<std::size_t>( st.st_size );
+				int flags = MAP_PRIVATE;
+#if defined( MAP_POPULATE )
+				if( populate ) {
+					flags |= MAP_POPULATE;
+				}
+#else
+				(void)populate;
+#endif
+				void *ptr = ::mmap( nullptr, size, PROT_READ, flags, fd, 0 );
+				::close( fd );
+				daw_json_ensure( ptr != MAP_FAILED, ErrorReason::UnableToOpenFile );
+#if defined( MADV_SEQUENTIAL )
+				(void)::madvise( ptr, size, MADV_SEQUENTIAL );
+#endif
+				m_data = static_cast<char const *>( ptr );
+				m_size = size;
+				// The rest of the last page is zero filled by mmap.  When the file
+				// ends on a page boundary there is nothing readable after it
+				auto const page_size = ::sysconf( _SC_PAGESIZE );
+				m_is_zero_terminated =
+				  page_size > 0 and size % static_cast<std::size_t>( page_size ) != 0;
+#else
+				(void)populate;
+				auto file = std::ifstream( path, std::ios::binary | std::ios::ate );
+				daw_json_ensure( file, ErrorReason::UnableToOpenFile );
+				auto const size = static_cast<std::size_t>( file.tellg( ) );
+				file.seekg( 0 );
+				auto buffer = std::make_unique<char[]>( size + 1 );
+				file.read( buffer.get( ), static_cast<std::streamsize>( size ) );
+				daw_json_ensure( file, ErrorReason::UnableToOpenFile );
+				buffer[size] = '\0';
+				m_data = buffer.release( );
+				m_size = size;
+				m_is_zero_terminated = true;
+#endif
+			}
+
+			json_mapped_file( json_mapped_file &&other ) noexcept
+			  : m_data( std::exchange( other.m_data, nullptr ) )
+			  , m_size( std::exchange( other.m_size, 0 ) )
+			  , m_is_zero_terminated(
+			      std::exchange( other.m_is_zero_terminated, false ) ) {}
+
+			json_mapped_file &operator=( json_mapped_file &&rhs ) noexcept {
+				if( this != &rhs ) {
+					reset( );
+					m_data = std::exchange( rhs.m_data, nullptr );
+					m_size = std::exchange( rhs.m_size, 0 );
+					m_is_zero_terminated =
+					  std::exchange( rhs.m_is_zero_terminated, false );
+				}
+				return *this;
+			}
+
+			json_mapped_file( json_mapped_file const & ) = delete;
+			json_mapped_file &operator=( json_mapped_file const & ) = delete;
+
+			~json_mapped_file( ) {
+				reset( );
+			}
+
+			[[nodiscard]] char const *data( ) const noexcept {
+				return m_data;
+			}
+
+			[[nodiscard]] std::size_t size( ) const noexcept {
+				return m_size;
+			}
+
+			[[nodiscard]] bool empty( ) const noexcept {
+				return m_size == 0;
+			}
+
+			/// @brief The byte after the file is readable and is zero, the
+			/// options::ZeroTerminatedString optimizations can be used
+			[[nodiscard]] bool is_zero_terminated( ) const noexcept {
+				return m_is_zero_terminated;
+			}
+
+			[[nodiscard]] std::string_view view( ) const noexcept {
+				return std::string_view( m_data, m_size );
+			}
+		};
+
+		/// @brief The result of from_json_file.  The file stays mapped for as
+		/// long as the value so that string_view members remain valid
+		template<typename T>
+		struct json_file_value {
+			json_mapped_file file;
+			T value;
+		};
+
+		/***
+		 * @brief Parse a whole file without copying it into a string first.  When
+		 * the byte after the file is readable the zero terminated string
+		 * optimizations are used.
+		 * @tparam JsonElement any bool, arithmetic, string, string_view,
+		 * daw::json::json_data_contract
+		 * @param path The file to parse
+		 * @return A json_file_value holding the file and the parsed value
+		 * @throws daw::json::json_exception
+		 */
+		template<typename JsonElement, auto... PolicyFlags>
+		[[nodiscard]] auto
+		from_json_file( std::string const &path,
+		                options::parse_flags_t<PolicyFlags...> = { } ) {
+			auto file = json_mapped_file( path, true );
+			using value_t = decltype( from_json<JsonElement>(
+			  file.view( ), options::parse_flags<PolicyFlags...> ) );
+			if( file.is_zero_terminated( ) ) {
+				auto value = from_json<JsonElement>(
+				  file.view( ),
+				  options::parse_flags<PolicyFlags...,
+				                       options::ZeroTerminatedString::yes> );
+				return json_file_value<value_t>{ std::move( file ),
+				                                 std::move( value ) };
+			}
+			auto value = from_json<JsonElement>(
+			  file.view( ), options::parse_flags<PolicyFlags...> );
+			return json_file_value<value_t>{ std::move( file ), std::move( value ) };
+		}
+
+		/***
+		 * @brief A json_array_range over the array in a file.  The file stays
+		 * mapped for as long as any copy of the range so that string_view
+		 * elements remain valid.  The file is read as the range is iterated
+		 * @tparam JsonElement Type of each element in array
+		 */
+		template<typename JsonElement = json_value, auto... PolicyFlags>
+		class json_array_range_file {
+			// The file is mapped read only
+			static_assert( not BasicParsePolicy<options::details::make_parse_flags<
+			                 PolicyFlags...>( ).value>::unescape_in_place,
+			               "options::UnescapeInPlace is not supported by "
+			               "json_array_range_file" );
+
+			std::shared_ptr<json_mapped_file const> m_file;
+			json_array_range<JsonElement, PolicyFlags...> m_range;
+
+		public:
+			using iterator = json_array_iterator<JsonElement, PolicyFlags...>;
+
+			explicit json_array_range_file( std::string const &path )
+			  : m_file( std::make_shared<json_mapped_file const>( path ) )
+			  , m_range( daw::string_view( m_file->data( ), m_file->size( ) ) ) {}
+
+			/// @param start_path The path to the array in the document
+			explicit json_array_range_file( std::string const &path,
+			                                daw::string_view start_path )
+			  : m_file( std::make_shared<json_mapped_file const>( path ) )
+			  , m_range( daw::string_view( m_file->data( ), m_file->size( ) ),
+			             start_path ) {}
+
+			[[nodiscard]] iterator begin( ) const {
+				return m_range.begin( );
+			}
+
+			[[nodiscard]] iterator end( ) const {
+				return m_range.end( );
+			}
+
+			[[nodiscard]] bool empty( ) const {
+				return m_range.empty( );
+			}
+
+			[[nodiscard]] json_mapped_file const &file( ) const {
+				return *m_file;
+			}
+		};
+
+		/***
+		 * @brief A json_lines_range over a JSON Lines file.  The file stays
+		 * mapped for as long as any copy of the range so that string_view
+		 * elements remain valid.  The file is read as the range is iterated
+		 * @tparam JsonElement Type of each line
+		 */
+		template<typename JsonElement = json_value, auto... PolicyFlags>
+		class json_lines_range_file {
+			// The file is mapped read only
+			static_assert( not BasicParsePolicy<options::details::make_parse_flags<
+			                 PolicyFlags...>( ).value>::unescape_in_place,
+			               "options::UnescapeInPlace is not supported by "
+			               "json_lines_range_file" );
+
+			std::shared_ptr<json_mapped_file const> m_file;
+			json_lines_range<JsonElement, PolicyFlags...> m_range;
+
+		public:
+			using iterator = json_lines_iterator<JsonElement, PolicyFlags...>;
+
+			explicit json_lines_range_file( std::string const &path )
+			  : m_file( std::make_shared<json_mapped_file const>( path ) )
+			  , m_range( daw::string_view( m_file->data( ), m_file->size( ) ) ) {}
+
+			[[nodiscard]] iterator begin( ) const {
+				return m_range.begin( );
+			}
+
+			[[nodiscard]] iterator end( ) const {
+				return m_range.end( );
+			}
+
+			[[nodiscard]] bool empty( ) const {
+				return m_range.empty( );
+			}
+
+			[[nodiscard]] json_mapped_file const &file( ) const {
+				return *m_file;
+			}
+		};
+	} // namespace DAW_JSON_VER
+} // namespace daw::json
@@ -83,6 +83,12 @@ namespace daw::json {
 			// Can do forward iteration and be stored
 			using iterator_category = std::input_iterator_tag;
 
+			// Dereferencing parses the element again, which would decode its
+			// strings a second time
+			static_assert( not ParseState::unescape_in_place,
+			               "options::UnescapeInPlace is not supported by "
+			               "json_array_iterator, use json_array_iterator_once" );
+
 		private:
 			ParseState m_state = ParseState( );
 			/***
@@ -259,11 +265,11 @@ namespace daw::json {
 		private:
 			mutable ParseState m_state = ParseState( );
 
-		public:
-			explicit json_array_iterator_once( ) = default;
+			struct from_buffer_t {};
 
-			explicit constexpr json_array_iterator_once( daw::string_view jd )
-			  : m_state( ParseState( std::data( jd ), daw::data_end( jd ) ) ) {
+			explicit constexpr json_array_iterator_once( from_buffer_t,
+			                                             ParseState parse_state )
+			  : m_state( std::move( parse_state ) ) {
 
 				m_state.trim_left( );
 				daw_json_assert_weak( m_state.is_opening_bracket_checked( ),
@@ -273,18 +279,49 @@ namespace daw::json {
 				m_state.trim_left( );
 			}
 
-			explicit constexpr json_array_iterator_once( daw::string_view jd,
-			                                             daw::string_view start_path )
-			  : m_state( get_range( jd, start_path ) ) {
+		public:
+			explicit json_array_iterator_once( ) = default;
 
-				m_state.trim_left( );
-				daw_json_assert_weak( m_state.is_opening_bracket_checked( ),
-				                      ErrorReason::InvalidArrayStart, m_state );
+			explicit constexpr json_array_iterator_once( daw::string_view jd )
+			  : json_array_iterator_once(
+			      from_buffer_t{ },
+			      ParseState( std::data( jd ), daw::data_end( jd ) ) ) {
+				static_assert( not ParseState::unescape_in_place,
+				               "options::UnescapeInPlace requires a mutable buffer" );
+			}
 
-				m_state.remove_prefix( );
-				m_state.trim_left( );
+			explicit constexpr json_array_iterator_once( daw::string_view jd,
+			                                             daw::string_view start_path )
+			  : json_array_iterator_once( from_buffer_t{ },
+			                              get_range( jd, start_path ) ) {
+				static_assert( not ParseState::unescape_in_place,
+				               "options::UnescapeInPlace requires a mutable buffer" );
 			}
 
+			/// @brief Construct from a mutable buffer.  With
+			/// options::UnescapeInPlace, the strings of each element are decoded in
+			/// the buffer when it is parsed
+			template<typename String,
+			         std::enable_if_t<json_details::is_mutable_buffer_v<String>,
+			                          std::nullptr_t> = nullptr>
+			explicit constexpr json_array_iterator_once( String &&jd )
+			  : json_array_iterator_once(
+			      from_buffer_t{ },
+			      ParseState( std::data( jd ), daw::data_end( jd ) ) ) {}
+
+			/// @brief Construct from a mutable buffer.  With
+			/// options::UnescapeInPlace, the strings of each element are decoded in
+			/// the buffer when it is parsed
+			template<typename String,
+			         std::enable_if_t<json_details::is_mutable_buffer_v<String>,
+			                          std::nullptr_t> = nullptr>
+			explicit constexpr json_array_iterator_once( String &&jd,
+			                                             daw::string_view start_path )
+			  : json_array_iterator_once(
+			      from_buffer_t{ },
+			      get_range( daw::string_view( std::data( jd ), std::size( jd ) ),
+			                 start_path ) ) {}
+
 			/// @brief Parse the current element
 			/// @pre good( ) returns true
 			/// @return The parsed result of ParseElement
@@ -425,6 +462,21 @@ namespace daw::json {
 			                                          daw::string_view start_path )
 			  : m_first( jd, start_path ) {}
 
+			/// @brief Construct from a mutable buffer, see options::UnescapeInPlace
+			template<typename String,
+			         std::enable_if_t<json_details::is_mutable_buffer_v<String>,
+			                          std::nullptr_t> = nullptr>
+			explicit constexpr json_array_range_once( String &&jd )
+			  : m_first( DAW_FWD( jd ) ) {}
+
+			/// @brief Construct from a mutable buffer, see options::UnescapeInPlace
+			template<typename String,
+			         std::enable_if_t<json_details::is_mutable_buffer_v<String>,
+			                          std::nullptr_t> = nullptr>
+			explicit constexpr json_array_range_once( String &&jd,
+			                                          daw::string_view start_path )
+			  : m_first( DAW_FWD( jd ), start_path ) {}
+
 			/// @return first item in range
 			[[nodiscard]] constexpr iterator begin( ) const {
 				return m_first;
@@ -51,6 +51,12 @@ namespace daw::json {
 			// Can do forward iteration and be stored
 			using iterator_category = std::input_iterator_tag;
 
+			// Dereferencing parses the element again, which would decode its
+			// strings a second time
+			static_assert( not ParseState::unescape_in_place,
+			               "options::UnescapeInPlace is not supported by "
+			               "json_lines_iterator" );
+
 		private:
 			ParseState m_state = ParseState( );
 			/***
@@ -0,0 +1,238 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#pragma once
+
+#include "impl/version.h"
+
+#include "daw_json_lines_iterator.h"
+
+#include <daw/daw_string_view.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace daw::json {
+	inline namespace DAW_JSON_VER {
+		/// @brief Options for parallel_for_each_jsonl and parallel_from_jsonl
+		struct jsonl_parallel_options {
+			/// Number of threads to parse with, including the calling thread.  0 uses
+			/// std::thread::hardware_concurrency( )
+			std::size_t thread_count = 0;
+			/// The document is split into thread_count * partitions_per_thread
+			/// ranges of lines.  Threads take the next range when they finish one,
+			/// so more ranges balance documents with uneven lines better
+			std::size_t partitions_per_thread = 8;
+			/// parallel_from_jsonl returns the elements in document order.  When
+			/// false, each thread collects its elements in one buffer and the order
+			/// is unspecified
+			bool preserve_order = true;
+		};
+
+		namespace json_details {
+			/// @return thread_count, or the hardware thread count when it is 0
+			[[nodiscard]] inline std::size_t
+			parallel_thread_count( std::size_t thread_count ) {
+				if( thread_count != 0 ) {
+					return thread_count;
+				}
+				auto const hw_threads =
+				  static_cast<std::size_t>( std::thread::hardware_concurrency( ) );
+				return hw_threads == 0 ? 1 : hw_threads;
+			}
+
+			[[nodiscard]] inline std::size_t
+			jsonl_thread_count( jsonl_parallel_options const &opts ) {
+				return parallel_thread_count( opts.thread_count );
+			}
+
+			[[nodiscard]] inline std::size_t
+			jsonl_partition_count( jsonl_parallel_options const &opts ) {
+				return jsonl_thread_count( opts ) *
+				       std::max( opts.partitions_per_thread, std::size_t{ 1 } );
+			}
+
+			/***
+			 * Run task( thread_index, partition_index ) for each partition on
+			 * thread_count threads, the calling thread being one of them.  The
+			 * partitions are handed out from a shared counter so that a thread that
+			 * finishes early takes on the remaining work.  The first exception
+			 * thrown by a task stops the remaining partitions from starting and is
+			 * rethrown after all threads have finished.
+			 */
+			template<typename Task>
+			void run_jsonl_partitions( std::size_t thread_count,
+			                           std::size_t partition_count,
+			                           Task const &task ) {
+				if( partition_count == 0 ) {
+					return;
+				}
+				thread_count = std::clamp( thread_count, std::size_t{ 1 },
+				                           partition_count );
+				auto next_partition = std::atomic<std::size_t>{ 0 };
+#if defined( DAW_USE_EXCEPTIONS )
+				auto first_error = std::exception_ptr( );
+				auto error_mutex = std::mutex( );
+#endif
+				auto const worker = [&]( std::size_t thread_index ) {
+#if defined( DAW_USE_EXCEPTIONS )
+					try {
+#endif
+						auto partition_index =
+						  next_partition.fetch_add( 1, std::memory_order_relaxed );
+						while( partition_index < partition_count ) {
+							task( thread_index, partition_index );
+							partition_index =
+							  next_partition.fetch_add( 1, std::memory_order_relaxed );
+						}
+#if defined( DAW_USE_EXCEPTIONS )
+					} catch( ... ) {
+						// Stop handing out partitions
+						next_partition.store( partition_count,
+						                      std::memory_order_relaxed );
+						auto const lck = std::lock_guard<std::mutex>( error_mutex );
+						if( not first_error ) {
+							first_error = std::current_exception( );
+						}
+					}
+#endif
+				};
+				auto threads = std::vector<std::thread>( );
+				threads.reserve( thread_count - 1 );
+				for( std::size_t n = 1; n < thread_count; ++n ) {
+					threads.emplace_back( worker, n );
+				}
+				worker( 0 );
+				for( auto &t : threads ) {
+					t.join( );
+				}
+#if defined( DAW_USE_EXCEPTIONS )
+				if( first_error ) {
+					std::rethrow_exception( first_error );
+				}
+#endif
+			}
+
+			/// Keep the buffers of different threads on separate cache lines
+			template<typename T>
+			struct alignas( 64 ) jsonl_thread_buffer {
+				std::vector<T> values;
+			};
+
+			template<typename T, typename Buffers, typename GetValues>
+			[[nodiscard]] std::vector<T> merge_jsonl_buffers( Buffers &buffers,
+			                                                  GetValues get_values ) {
+				if( buffers.size( ) == 1 ) {
+					return std::move( get_values( buffers.front( ) ) );
+				}
+				std::size_t total = 0;
+				for( auto &b : buffers ) {
+					total += get_values( b ).size( );
+				}
+				auto result = std::vector<T>( );
+				result.reserve( total );
+				for( auto &b : buffers ) {
+					auto &values = get_values( b );
+					result.insert( result.end( ),
+					               std::make_move_iterator( values.begin( ) ),
+					               std::make_move_iterator( values.end( ) ) );
+				}
+				return result;
+			}
+		} // namespace json_details
+
+		/// @brief Parse each line of the JSON Lines document on multiple threads
+		/// and call func with each element.
+		/// @tparam JsonElement The type of each line
+		/// @param jsonl_doc The JSON Lines document
+		/// @param func Called with each parsed element.  It is called concurrently
+		/// from different threads and in no particular order
+		/// @param opts The thread count and partitioning to use
+		/// @throws daw::json::json_exception The first error from any thread
+		template<typename JsonElement = json_value, auto... PolicyFlags,
+		         typename Function>
+		void parallel_for_each_jsonl(
+		  daw::string_view jsonl_doc, Function const &func,
+		  jsonl_parallel_options const &opts = jsonl_parallel_options{ } ) {
+			auto const partitions =
+			  partition_jsonl_document<JsonElement, PolicyFlags...>(
+			    json_details::jsonl_partition_count( opts ), jsonl_doc );
+			json_details::run_jsonl_partitions(
+			  json_details::jsonl_thread_count( opts ), partitions.size( ),
+			  [&]( std::size_t, std::size_t partition_index ) {
+				  for( auto &&value : partitions[partition_index] ) {
+					  func( std::move( value ) );
+				  }
+			  } );
+		}
+
+		/// @brief Parse the JSON Lines document on multiple threads
+		/// @tparam JsonElement The type of each line
+		/// @param jsonl_doc The JSON Lines document
+		/// @param opts The thread count, partitioning and ordering to use
+		/// @return A vector with an element for each line.  They are in document
+		/// order unless opts.preserve_order is false
+		/// @throws daw::json::json_exception The first error from any thread
+		template<typename JsonElement = json_value, auto... PolicyFlags>
+		[[nodiscard]] std::vector<
+		  typename json_lines_iterator<JsonElement, PolicyFlags...>::value_type>
+		parallel_from_jsonl(
+		  daw::string_view jsonl_doc,
+		  jsonl_parallel_options const &opts = jsonl_parallel_options{ } ) {
+			using value_type =
+			  typename json_lines_iterator<JsonElement, PolicyFlags...>::value_type;
+			auto const thread_count = json_details::jsonl_thread_count( opts );
+			auto const partitions =
+			  partition_jsonl_document<JsonElement, PolicyFlags...>(
+			    json_details::jsonl_partition_count( opts ), jsonl_doc );
+			if( partitions.empty( ) ) {
+				return std::vector<value_type>( );
+			}
+			if( opts.preserve_order ) {
+				// One buffer per partition, concatenated in document order
+				auto buffers =
+				  std::vector<std::vector<value_type>>( partitions.size( ) );
+				json_details::run_jsonl_partitions(
+				  thread_count, partitions.size( ),
+				  [&]( std::size_t, std::size_t partition_index ) {
+					  auto const &part = partitions[partition_index];
+					  buffers[partition_index] =
+					    std::vector<value_type>( part.begin( ), part.end( ) );
+				  } );
+				return json_details::merge_jsonl_buffers<value_type>(
+				  buffers,
+				  []( std::vector<value_type> &b ) -> std::vector<value_type> & {
+					  return b;
+				  } );
+			}
+			// One buffer per thread
+			auto buffers =
+			  std::vector<json_details::jsonl_thread_buffer<value_type>>(
+			    std::min( thread_count, partitions.size( ) ) );
+			json_details::run_jsonl_partitions(
+			  thread_count, partitions.size( ),
+			  [&]( std::size_t thread_index, std::size_t partition_index ) {
+				  auto &values = buffers[thread_index].values;
+				  for( auto &&value : partitions[partition_index] ) {
+					  values.push_back( std::move( value ) );
+				  }
+			  } );
+			return json_details::merge_jsonl_buffers<value_type>(
+			  buffers,
+			  []( json_details::jsonl_thread_buffer<value_type> &b )
+			    -> std::vector<value_type> & { return b.values; } );
+		}
+	} // namespace DAW_JSON_VER
+} // namespace daw::json
@@ -0,0 +1,250 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#pragma once
+
+#include "impl/version.h"
+
+#include "daw_json_lines_iterator.h"
+#include "impl/daw_json_assert.h"
+
+#include <daw/daw_string_view.h>
+
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <iterator>
+#include <vector>
+
+#if defined( __unix__ ) or defined( __APPLE__ )
+#define DAW_JSON_HAS_FD_STREAMS
+#include <cerrno>
+#include <unistd.h>
+#endif
+
+namespace daw::json {
+	inline namespace DAW_JSON_VER {
+		namespace json_details {
+			/// @brief Find the last newline in [first, last)
+			/// @return A pointer to the newline or nullptr
+			[[nodiscard]] inline char const *find_last_newline( char const *first,
+			                                                    char const *last ) {
+#if defined( __GLIBC__ )
+				// The glibc memrchr is vectorized
+				return static_cast<char const *>( ::memrchr(
+				  first, '\n', static_cast<std::size_t>( last - first ) ) );
+#else
+				while( last != first ) {
+					--last;
+					if( *last == '\n' ) {
+						return last;
+					}
+				}
+				return nullptr;
+#endif
+			}
+		} // namespace json_details
+
+		/***
+		 * @brief Parse a JSON Lines document as it is read from a file descriptor
+		 * or FILE *, using memory bounded by the buffer size and the longest
+		 * record.  The input is read into a buffer and the complete lines in it
+		 * are parsed with a json_lines_iterator.  The partial record after the
+		 * last newline is moved to the front of the buffer before reading more,
+		 * and the buffer grows when a record does not fit.
+		 * @tparam JsonElement Type of each line
+		 * @note Each record must be on a single line.  string_view results
+		 * point into the buffer and are valid until the iterator is incremented
+		 */
+		template<typename JsonElement = json_value, auto... PolicyFlags>
+		class json_lines_stream {
+			using lines_iterator = json_lines_iterator<JsonElement, PolicyFlags...>;
+
+		public:
+			using value_type = typename lines_iterator::value_type;
+			static constexpr std::size_t default_buffer_size = 1024U * 1024U;
+
+		private:
+#if defined( DAW_JSON_HAS_FD_STREAMS )
+			int m_fd = -1;
+#endif
+			std::FILE *m_file = nullptr;
+			std::vector<char> m_buffer;
+			// Bytes read into m_buffer
+			std::size_t m_data_end = 0;
+			// End of the complete lines being parsed
+			std::size_t m_chunk_end = 0;
+			bool m_eof = false;
+			lines_iterator m_current{ };
+
+			[[nodiscard]] std::size_t read_some( char *buffer, std::size_t size ) {
+#if defined( DAW_JSON_HAS_FD_STREAMS )
+				if( m_fd >= 0 ) {
+					while( true ) {
+						auto const count = ::read( m_fd, buffer, size );
+						if( count >= 0 ) {
+							return static_cast<std::size_t>( count );
+						}
+						daw_json_ensure( errno == EINTR, ErrorReason::UnableToReadFile );
+					}
+				}
+#endif
+				auto const count = std::fread( buffer, 1, size, m_file );
+				daw_json_ensure( count != 0 or std::ferror( m_file ) == 0,
+				                 ErrorReason::UnableToReadFile );
+				return count;
+			}
+
+			/// Read until the buffer holds at least one complete line or the end
+			/// of the input
+			/// @return false when there is no more input
+			[[nodiscard]] bool fill_chunk( ) {
+				std::size_t const tail = m_data_end - m_chunk_end;
+				if( tail > 0 and m_chunk_end > 0 ) {
+					std::memmove( m_buffer.data( ), m_buffer.data( ) + m_chunk_end,
+					              tail );
+				}
+				m_data_end = tail;
+				m_chunk_end = 0;
+				while( not m_eof ) {
+					if( m_data_end == m_buffer.size( ) ) {
+						// The record is longer than the buffer
+						m_buffer.resize( m_buffer.size( ) * 2U );
+					}
+					char *const first = m_buffer.data( ) + m_data_end;
+					std::size_t const count =
+					  read_some( first, m_buffer.size( ) - m_data_end );
+					if( count == 0 ) {
+						m_eof = true;
+						break;
+					}
+					m_data_end += count;
+					// Only the new bytes can hold the first newline
+					if( char const *nl =
+					      json_details::find_last_newline( first, first + count );
+					    nl != nullptr ) {
+						m_chunk_end =
+						  static_cast<std::size_t>( nl - m_buffer.data( ) ) + 1U;
+						return true;
+					}
+				}
+				// The last record does not need a trailing newline
+				m_chunk_end = m_data_end;
+				return m_chunk_end > 0;
+			}
+
+			/// @return false when there are no more elements
+			[[nodiscard]] bool next_chunk( ) {
+				do {
+					if( not fill_chunk( ) ) {
+						m_current = lines_iterator( );
+						return false;
+					}
+					m_current = lines_iterator(
+					  daw::string_view( m_buffer.data( ), m_chunk_end ) );
+					// Chunks of blank lines have no elements
+				} while( not m_current.good( ) );
+				return true;
+			}
+
+			void init( std::size_t buffer_size ) {
+				m_buffer.resize( buffer_size == 0 ? default_buffer_size
+				                                  : buffer_size );
+			}
+
+		public:
+			/// @param file An open file to read until its end.  It is not closed
+			/// @param buffer_size The initial size of the read buffer
+			explicit json_lines_stream(
+			  std::FILE *file, std::size_t buffer_size = default_buffer_size )
+			  : m_file( file ) {
+				daw_json_ensure( file != nullptr, ErrorReason::UnableToReadFile );
+				init( buffer_size );
+			}
+
+#if defined( DAW_JSON_HAS_FD_STREAMS )
+			/// @param fd An open file descriptor, such as a pipe, to read until
+			/// its end.  It is not closed
+			/// @param buffer_size The initial size of the read buffer
+			explicit json_lines_stream(
+			  int fd, std::size_t buffer_size = default_buffer_size )
+			  : m_fd( fd ) {
+				daw_json_ensure( fd >= 0, ErrorReason::UnableToReadFile );
+				init( buffer_size );
+			}
+#endif
+
+			json_lines_stream( json_lines_stream const & ) = delete;
+			json_lines_stream &operator=( json_lines_stream const & ) = delete;
+
+			/// @brief A single pass iterator over the elements of the stream
+			class iterator {
+				json_lines_stream *m_stream = nullptr;
+
+			public:
+				using value_type = typename json_lines_stream::value_type;
+				using reference = value_type;
+				using pointer = json_details::arrow_proxy<value_type>;
+				using difference_type = std::ptrdiff_t;
+				using iterator_category = std::input_iterator_tag;
+
+				iterator( ) = default;
+				explicit iterator( json_lines_stream *stream )
+				  : m_stream( stream ) {}
+
+				[[nodiscard]] value_type operator*( ) const {
+					return *m_stream->m_current;
+				}
+
+				[[nodiscard]] pointer operator->( ) const {
+					return pointer{ operator*( ) };
+				}
+
+				iterator &operator++( ) {
+					++m_stream->m_current;
+					if( not m_stream->m_current.good( ) and
+					    not m_stream->next_chunk( ) ) {
+						m_stream = nullptr;
+					}
+					return *this;
+				}
+
+				void operator++( int ) {
+					(void)operator++( );
+				}
+
+				[[nodiscard]] friend bool operator==( iterator const &lhs,
+				                                      iterator const &rhs ) {
+					return lhs.m_stream == rhs.m_stream;
+				}
+
+				[[nodiscard]] friend bool operator!=( iterator const &lhs,
+				                                      iterator const &rhs ) {
+					return lhs.m_stream != rhs.m_stream;
+				}
+			};
+
+			/// @brief Start or continue reading the stream
+			[[nodiscard]] iterator begin( ) {
+				if( not m_current.good( ) and not next_chunk( ) ) {
+					return iterator( );
+				}
+				return iterator( this );
+			}
+
+			[[nodiscard]] iterator end( ) {
+				return iterator( );
+			}
+
+			/// @brief The current size of the read buffer
+			[[nodiscard]] std::size_t buffer_size( ) const {
+				return m_buffer.size( );
+			}
+		};
+	} // namespace DAW_JSON_VER
+} // namespace daw::json
@@ -11,6 +11,7 @@
 #include "impl/version.h"
 
 #include "impl/daw_json_link_types_fwd.h"
+#include "impl/daw_json_parse_into.h"
 #include "impl/daw_json_serialize_impl.h"
 #include "impl/daw_json_traits.h"
 
@@ -100,6 +101,31 @@ namespace daw::json {
 				return json_details::parse_json_class<JsonClass, JsonMembers...>(
 				  parse_state, std::index_sequence_for<JsonMembers...>{ } );
 			}
+
+			/// The members of an existing JsonClass value can be parsed into
+			/// directly.  See from_json_into
+			template<typename JsonClass>
+			static constexpr bool can_parse_into_v =
+			  json_details::can_parse_class_members_into<JsonClass,
+			                                             JsonMembers...>( );
+
+			/**
+			 * Parse JSON data into the members of an existing C++ class, reusing
+			 * the storage they own.  This is used by parse_value_into
+			 * @tparam JsonClass The mapping of the class being parsed into
+			 * @tparam ParseState Input range type
+			 * @param parse_state JSON data to parse
+			 * @param value The class to parse into
+			 */
+			template<typename JsonClass, typename ParseState>
+			DAW_ATTRIB_INLINE static constexpr void
+			parse_to_class_into( ParseState &parse_state,
+			                     json_details::json_result_t<JsonClass> &value ) {
+				static_assert( json_details::is_a_json_type_v<JsonClass> );
+				static_assert( can_parse_into_v<JsonClass> );
+				json_details::parse_json_class_into<JsonClass, JsonMembers...>(
+				  parse_state, value, std::index_sequence_for<JsonMembers...>{ } );
+			}
 		};
 		///
 		/// Deduce the json type mapping based on common types and types already
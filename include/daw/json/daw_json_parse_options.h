@@ -30,8 +30,17 @@ namespace daw::json {
 					/// methods
 					runtime,
 					/// @brief *testing* Allow code paths that use SIMD intrinsics
-					simd
-				}; // 2bits
+					simd,
+					/// @brief *testing* Use the AVX2 kernels.  The host must support
+					/// AVX2
+					avx2,
+					/// @brief *testing* Use the AVX512BW kernels.  The host must support
+					/// AVX512F and AVX512BW
+					avx512,
+					/// @brief Detect the host CPU once at runtime and use the widest
+					/// kernels it supports, falling back to runtime
+					best_available
+				}; // 3bits
 
 				///
 				/// @brief Input is a zero terminated string.  If this cannot be
@@ -90,10 +99,12 @@ namespace daw::json {
 				enum class AllowEscapedNames : unsigned { no, yes }; // 1bit
 
 				///
-				///@note Testing
 				///@brief Use precise IEEE754 parsing of real numbers.  The default is
 				/// no,
 				/// and results is much faster parsing with very small errors of 0-2ulp.
+				/// float and double use the Eisel-Lemire algorithm and only fall back
+				/// to from_chars/strtod for numbers with more than 19 significant
+				/// digits or that are too close to halfway between two values.
 				///
 				/// default: no
 				///
@@ -137,6 +148,7 @@ namespace daw::json {
 				/// @brief When enabled, the parser can temporarily set a character to
 				/// the desired token. This allows for safe searching without bounds
 				/// checking. If the buffer is not mutable, it will not be enabled.
+				/// See UnescapeInPlace for a mode that writes to the buffer
 				///
 				/// default: no
 				///
@@ -152,6 +164,101 @@ namespace daw::json {
 				/// default: no
 				///
 				enum class ExcludeSpecialEscapes : unsigned { no, yes }; // 1bit
+
+				///
+				/// @brief Build an index of the structural characters in the document
+				/// before parsing and skip classes and arrays by walking it instead
+				/// of the bytes of the document.  Only skips use the index, that is
+				/// unmapped members and the arrays that are skipped to find their
+				/// size.  Moving from member to member and from element to element
+				/// reads the document as usual.  This costs an allocation and a pass
+				/// over the document, so it helps large documents where a lot of
+				/// data is skipped.  It is not available with comment policies and
+				/// is not constexpr.
+				///
+				/// default: no
+				///
+				enum class SkipWithStructuralIndex : unsigned { no, yes }; // 1bit
+
+				///
+				/// @brief How member names are matched to the mapped members of a
+				/// class.  length_and_bytes finds, at compile time, up to two byte
+				/// offsets that with the name length tell the members apart.  Keys
+				/// are then matched on those instead of hashing the whole key and a
+				/// full name comparison confirms the match.  If no such offsets
+				/// exist, or the class has more than 128 members, hash is used.
+				/// hash_linear_scan hashes the key like hash, but compares it with
+				/// each mapped hash in turn instead of probing the lookup table that
+				/// classes with 16 or more members have.  It is the baseline for
+				/// measuring the other two.
+				///
+				/// default: hash
+				///
+				enum class MemberNameMatching : unsigned {
+					hash,
+					length_and_bytes,
+					hash_linear_scan
+				}; // 2bits
+
+				///
+				/// @brief Remember the order members are seen in for each mapped class
+				/// and parse classes in document order, storing the values until the
+				/// class can be constructed.  Member names that match the remembered
+				/// order are not looked up, when it misses the name is looked up as
+				/// usual and the new order is remembered.  This helps when documents
+				/// have a stable member order that differs from the order of the
+				/// json_member_list.  The order is kept per thread and is not
+				/// available in a constant expression.  Classes with members that
+				/// cannot be moved or that need the class position are parsed as
+				/// usual.
+				///
+				/// default: no
+				///
+				enum class PredictMemberOrder : unsigned { no, yes }; // 1bit
+
+				///
+				/// @brief Decode strings with escapes in the buffer of the document.
+				/// The decoded string is never longer than the escaped one, so it is
+				/// written over the start of the string.  Raw string members, such
+				/// as std::string_view, refer to the decoded bytes instead of the
+				/// escaped ones and strings are constructed from the decoded bytes.
+				/// The document must be a mutable buffer, e.g. std::string &, and is
+				/// not valid JSON after parsing.  Each value must only be parsed
+				/// once, so a buffer cannot be parsed a second time and
+				/// json_intrusive_variant tag members cannot have escapes.
+				///
+				/// default: no
+				///
+				enum class UnescapeInPlace : unsigned { no, yes }; // 1bit
+
+				///
+				/// @brief Count the elements of an array before parsing it so that
+				/// the container is allocated once with the exact size instead of
+				/// growing.  The count is a scan of the array's commas and brackets,
+				/// vectorized when AVX2/AVX512 is available.  It is used by
+				/// Constructors that accept a json_details::element_count_hint after
+				/// the iterators, such as the default one for std::vector.  This
+				/// helps large arrays of small elements, e.g. numbers, and costs a
+				/// second pass over the array.  Each nested array counts its own
+				/// elements again, so the bytes scanned grow with the nesting depth;
+				/// limit the option to documents whose arrays are shallow.
+				///
+				/// default: no
+				///
+				enum class ExactArraySizing : unsigned { no, yes }; // 1bit
+
+				///
+				/// @brief Check that the contents of strings are valid UTF-8 while
+				/// scanning for their end.  Overlong encodings, surrogates, code
+				/// points above 0x10FFFF and truncated sequences are an
+				/// ErrorReason::InvalidString at the offending byte.  Runs of ASCII
+				/// are skipped with the vectorized string scanner of the exec mode.
+				/// With AVX2/AVX512, multi-byte text is validated 64 bytes at a
+				/// time, otherwise one sequence at a time.
+				///
+				/// default: no
+				///
+				enum class ValidateUTF8 : unsigned { no, yes }; // 1bit
 			} // namespace parser_options
 		}   // namespace options
 	}     // namespace DAW_JSON_VER
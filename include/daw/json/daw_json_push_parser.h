@@ -0,0 +1,306 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#pragma once
+
+#include "impl/version.h"
+
+#include "daw_from_json.h"
+#include "impl/daw_json_assert.h"
+#include "impl/daw_json_value.h"
+
+#include <daw/daw_data_end.h>
+#include <daw/daw_string_view.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace daw::json {
+	inline namespace DAW_JSON_VER {
+		/// @brief Parse a JSON document that arrives in chunks, such as from a
+		/// socket, without buffering the whole document.  When the document is an
+		/// array each element is parsed as soon as its last byte has been fed.
+		/// Otherwise the document is a sequence of whitespace separated values,
+		/// like JSON Lines, and each of them is parsed as it completes.
+		/// Only the bytes of an element that is split across chunks are copied,
+		/// elements within one chunk are parsed from it directly.
+		/// @tparam JsonElement The type of the array elements or values
+		template<typename JsonElement = json_value, auto... PolicyFlags>
+		class json_push_parser {
+		public:
+			using element_type = json_details::json_deduced_type<JsonElement>;
+			static_assert( not std::is_same_v<element_type, void>,
+			               "Unknown JsonElement type." );
+			using value_type = json_details::json_result_t<element_type>;
+			static_assert(
+			  not BasicParsePolicy<options::details::make_parse_flags<
+			    PolicyFlags...>( ).value>::unescape_in_place,
+			  "options::UnescapeInPlace is not supported by json_push_parser" );
+
+		private:
+			enum class scan_state : std::uint8_t {
+				document_start,
+				before_element,
+				in_element,
+				after_element,
+				done
+			};
+
+			/// The start of the element that is split across chunks
+			std::string m_carry{ };
+			std::size_t m_depth = 0;
+			scan_state m_state = scan_state::document_start;
+			bool m_is_array = false;
+			bool m_after_comma = false;
+			bool m_in_string = false;
+			bool m_is_escaped = false;
+			bool m_is_scalar = false;
+
+			[[nodiscard]] static constexpr bool is_ws( char c ) {
+				return c == ' ' or c == '\t' or c == '\n' or c == '\r';
+			}
+
+			[[nodiscard]] static constexpr char const *
+			skip_ws( char const *first, char const *const last ) {
+				while( first < last and is_ws( *first ) ) {
+					++first;
+				}
+				return first;
+			}
+
+			constexpr void start_element( char c ) {
+				switch( c ) {
+				case '{':
+				case '[':
+					m_depth = 1;
+					break;
+				case '"':
+					m_in_string = true;
+					break;
+				case '}':
+				case ']':
+				case ',':
+					daw_json_error( ErrorReason::InvalidStartOfValue );
+				default:
+					m_is_scalar = true;
+					break;
+				}
+				m_state = scan_state::in_element;
+			}
+
+			/// Scan the element to its end or to last.  The scan state is kept so
+			/// that it can continue in the next chunk
+			/// @return One past the end of the element when it is complete, last
+			/// otherwise
+			constexpr char const *scan_element( char const *first,
+			                                    char const *const last ) {
+				while( first < last ) {
+					if( m_in_string ) {
+						if( m_is_escaped ) {
+							m_is_escaped = false;
+							++first;
+							continue;
+						}
+						first = std::find_if( first, last, []( char c ) {
+							return c == '"' or c == '\\';
+						} );
+						if( first == last ) {
+							break;
+						}
+						if( *first++ == '\\' ) {
+							m_is_escaped = true;
+							continue;
+						}
+						m_in_string = false;
+						if( m_depth == 0 ) {
+							m_state = scan_state::after_element;
+							return first;
+						}
+						continue;
+					}
+					if( m_is_scalar ) {
+						// Numbers and literals end at the next delimiter, which is not
+						// part of them
+						char const c = *first;
+						if( is_ws( c ) or c == ',' or c == ']' or c == '}' ) {
+							m_is_scalar = false;
+							m_state = scan_state::after_element;
+							return first;
+						}
+						++first;
+						continue;
+					}
+					switch( *first++ ) {
+					case '"':
+						m_in_string = true;
+						break;
+					case '{':
+					case '[':
+						++m_depth;
+						break;
+					case '}':
+					case ']':
+						if( --m_depth == 0 ) {
+							m_state = scan_state::after_element;
+							return first;
+						}
+						break;
+					default:
+						break;
+					}
+				}
+				return last;
+			}
+
+			template<typename Callback>
+			void emit( char const *element_first, char const *element_last,
+			           Callback &on_element ) {
+				if( m_carry.empty( ) ) {
+					on_element( from_json<JsonElement>(
+					  std::string_view( element_first, static_cast<std::size_t>(
+					                                     element_last - element_first ) ),
+					  options::parse_flags<PolicyFlags...> ) );
+					return;
+				}
+				m_carry.append( element_first, element_last );
+				on_element( from_json<JsonElement>(
+				  std::string_view( m_carry ), options::parse_flags<PolicyFlags...> ) );
+				m_carry.clear( );
+			}
+
+		public:
+			explicit json_push_parser( ) = default;
+
+			/// @brief Scan the next chunk of the document and call on_element with
+			/// each element that is completed by it.  Values that refer to the
+			/// document, such as string_view or json_value, are only valid during
+			/// the call to on_element
+			/// @param chunk The next bytes of the document
+			/// @param on_element Callable taking a value_type
+			/// @throws daw::json::json_exception
+			template<typename Callback>
+			void feed( daw::string_view chunk, Callback &&on_element ) {
+				char const *first = std::data( chunk );
+				char const *const last = daw::data_end( chunk );
+				// An element continued from the last chunk starts at the chunk
+				char const *element_first = first;
+				while( first < last ) {
+					switch( m_state ) {
+					case scan_state::document_start:
+						first = skip_ws( first, last );
+						if( first == last ) {
+							break;
+						}
+						if( *first == '[' ) {
+							m_is_array = true;
+							++first;
+						}
+						m_state = scan_state::before_element;
+						break;
+					case scan_state::before_element:
+						first = skip_ws( first, last );
+						if( first == last ) {
+							break;
+						}
+						if( m_is_array and *first == ']' ) {
+							daw_json_ensure( not m_after_comma, ErrorReason::TrailingComma );
+							++first;
+							m_state = scan_state::done;
+							break;
+						}
+						element_first = first;
+						m_after_comma = false;
+						start_element( *first );
+						++first;
+						break;
+					case scan_state::in_element:
+						first = scan_element( first, last );
+						if( m_state == scan_state::after_element ) {
+							emit( element_first, first, on_element );
+						}
+						break;
+					case scan_state::after_element:
+						if( not m_is_array ) {
+							m_state = scan_state::before_element;
+							break;
+						}
+						first = skip_ws( first, last );
+						if( first == last ) {
+							break;
+						}
+						if( *first == ',' ) {
+							m_after_comma = true;
+							m_state = scan_state::before_element;
+						} else {
+							daw_json_ensure( *first == ']', ErrorReason::InvalidEndOfValue );
+							m_state = scan_state::done;
+						}
+						++first;
+						break;
+					case scan_state::done:
+						first = skip_ws( first, last );
+						daw_json_ensure( first == last, ErrorReason::InvalidEndOfValue );
+						break;
+					}
+				}
+				if( m_state == scan_state::in_element ) {
+					m_carry.append( element_first, last );
+				}
+			}
+
+			/// @brief Signal the end of the document.  A number or literal at the
+			/// end of a sequence of values is completed and passed to on_element.
+			/// The parser is then ready for a new document
+			/// @param on_element Callable taking a value_type
+			/// @throws daw::json::json_exception When the document is incomplete
+			template<typename Callback>
+			void finish( Callback &&on_element ) {
+				daw_json_ensure( m_state != scan_state::document_start,
+				                 ErrorReason::EmptyJSONDocument );
+				if( not m_is_array and m_state == scan_state::in_element and
+				    m_is_scalar ) {
+					// The value ends with the document, all of it is in the carry
+					on_element( from_json<JsonElement>(
+					  std::string_view( m_carry ),
+					  options::parse_flags<PolicyFlags...> ) );
+					m_state = scan_state::after_element;
+				}
+				if( m_is_array ) {
+					daw_json_ensure( m_state == scan_state::done,
+					                 ErrorReason::UnexpectedEndOfData );
+				} else {
+					daw_json_ensure( m_state == scan_state::before_element or
+					                   m_state == scan_state::after_element,
+					                 ErrorReason::UnexpectedEndOfData );
+				}
+				reset( );
+			}
+
+			/// @brief Has the closing bracket of the array been seen
+			[[nodiscard]] constexpr bool is_done( ) const {
+				return m_state == scan_state::done;
+			}
+
+			/// @brief Discard any partial element and start a new document
+			void reset( ) {
+				m_carry.clear( );
+				m_depth = 0;
+				m_state = scan_state::document_start;
+				m_is_array = false;
+				m_after_comma = false;
+				m_in_string = false;
+				m_is_escaped = false;
+				m_is_scalar = false;
+			}
+		};
+	} // namespace DAW_JSON_VER
+} // namespace daw::json
@@ -111,6 +111,38 @@
 // Allow experimental SIMD paths, if available
 // by defining DAW_ALLOW_SSE42 and using the parser policy ExecModeType simd
 
+// DAW_JSON_HAS_RUNTIME_CPU_DISPATCH is defined on x86-64 with GCC, Clang, or
+// MSVC.  It enables the avx2/avx512 exec modes, whose kernels are compiled with
+// function target attributes, and the best_available exec mode that picks the
+// widest one supported by the host at runtime.  Define
+// DAW_JSON_NO_RUNTIME_CPU_DISPATCH to disable
+#if not defined( DAW_JSON_NO_RUNTIME_CPU_DISPATCH ) and \
+  not defined( DAW_JSON_HAS_RUNTIME_CPU_DISPATCH )
+#if( defined( __x86_64__ ) and ( defined( __GNUC__ ) or defined( __clang__ ) ) and \
+     not defined( _MSC_VER ) ) or                                                  \
+  ( defined( _M_X64 ) and defined( _MSC_VER ) and not defined( __clang__ ) )
+#define DAW_JSON_HAS_RUNTIME_CPU_DISPATCH
+#endif
+#endif
+
+#if defined( DAW_JSON_HAS_RUNTIME_CPU_DISPATCH ) and not defined( _MSC_VER )
+#define DAW_JSON_TARGET_AVX2 __attribute__( ( target( "avx2,bmi,bmi2" ) ) )
+#define DAW_JSON_TARGET_AVX512 \
+	__attribute__( ( target( "avx2,bmi,bmi2,avx512f,avx512bw" ) ) )
+#else
+#define DAW_JSON_TARGET_AVX2
+#define DAW_JSON_TARGET_AVX512
+#endif
+
+// The 128 bit kernels shared by the sse42 and the wide exec modes
+#if( defined( DAW_JSON_HAS_RUNTIME_CPU_DISPATCH ) or \
+     defined( DAW_ALLOW_SSE42 ) ) and                 \
+  not defined( _MSC_VER )
+#define DAW_JSON_TARGET_SSE41 __attribute__( ( target( "sse4.1" ) ) )
+#else
+#define DAW_JSON_TARGET_SSE41
+#endif
+
 // Use strtod instead of from_chars when avialable by defining
 // DAW_JSON_USE_STRTOD
 #if not defined( DAW_JSON_USE_STRTOD ) and not defined( __cpp_lib_to_chars )
@@ -16,6 +16,7 @@
 #include "impl/daw_json_link_types_fwd.h"
 #include "impl/to_daw_json_string.h"
 
+#include <daw/daw_span.h>
 #include <daw/daw_traits.h>
 
 #include <iterator>
@@ -169,5 +170,46 @@ namespace daw::json {
 			result.shrink_to_fit( );
 			return result;
 		}
+
+		template<typename JsonClass, typename Value, auto... PolicyFlags>
+		constexpr std::size_t
+		to_json_size( Value const &value,
+		              options::output_flags_t<PolicyFlags...> flgs ) {
+			auto counter = json_output_size_counter{ };
+			(void)to_json<JsonClass>( value, counter, flgs );
+			return counter.size;
+		}
+
+		template<typename JsonElement, typename Container, auto... PolicyFlags>
+		constexpr std::size_t
+		to_json_array_size( Container const &c,
+		                    options::output_flags_t<PolicyFlags...> flgs ) {
+			auto counter = json_output_size_counter{ };
+			(void)to_json_array<JsonElement>( c, counter, flgs );
+			return counter.size;
+		}
+
+		template<typename JsonClass, typename Value, auto... PolicyFlags>
+		std::string to_json_exact( Value const &value,
+		                           options::output_flags_t<PolicyFlags...> flgs ) {
+			auto result = std::string( to_json_size<JsonClass>( value, flgs ), '\0' );
+			// Each write into the span is checked before it is done
+			auto out = daw::span<char>( result.data( ), result.size( ) );
+			(void)to_json<JsonClass>( value, out, flgs );
+			daw_json_ensure( out.empty( ), ErrorReason::OutputError );
+			return result;
+		}
+
+		template<typename JsonElement, typename Container, auto... PolicyFlags>
+		std::string
+		to_json_array_exact( Container const &c,
+		                     options::output_flags_t<PolicyFlags...> flgs ) {
+			auto result =
+			  std::string( to_json_array_size<JsonElement>( c, flgs ), '\0' );
+			auto out = daw::span<char>( result.data( ), result.size( ) );
+			(void)to_json_array<JsonElement>( c, out, flgs );
+			daw_json_ensure( out.empty( ), ErrorReason::OutputError );
+			return result;
+		}
 	} // namespace DAW_JSON_VER
 } // namespace daw::json
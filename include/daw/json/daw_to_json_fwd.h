@@ -13,6 +13,9 @@
 #include "impl/daw_json_link_types_fwd.h"
 #include "impl/daw_json_serialize_policy.h"
 
+#include <cstddef>
+#include <string>
+
 namespace daw::json {
 	inline namespace DAW_JSON_VER {
 		namespace options {
@@ -109,5 +112,53 @@ namespace daw::json {
 		inline std::string to_json_array(
 		  Container const &c,
 		  options::output_flags_t<PolicyFlags...> = options::output_flags<> );
+
+		/// @brief The exact number of bytes to_json writes for value, including
+		/// escapes, number widths and indentation.  The value is serialized
+		/// without storing the output
+		/// @tparam JsonClass Type that has json_parser_description and to_json_data
+		/// function overloads
+		/// @param value value to size
+		/// @return The size of the JSON representation of value
+		template<typename JsonClass = use_default, typename Value,
+		         auto... PolicyFlags>
+		[[nodiscard]] constexpr std::size_t to_json_size(
+		  Value const &value,
+		  options::output_flags_t<PolicyFlags...> = options::output_flags<> );
+
+		/// @brief The exact number of bytes to_json_array writes for c
+		/// @tparam Container Type of Container to size the elements of
+		/// @param c Container containing data to size
+		/// @return The size of the JSON array of the elements of c
+		template<typename JsonElement = use_default, typename Container,
+		         auto... PolicyFlags>
+		[[nodiscard]] constexpr std::size_t to_json_array_size(
+		  Container const &c,
+		  options::output_flags_t<PolicyFlags...> = options::output_flags<> );
+
+		/// @brief Serialize a value to a std::string allocated once with the
+		/// exact size from to_json_size.  The value is serialized a second time
+		/// into a span of the string, an output that is too small is an
+		/// OutputError
+		/// @tparam JsonClass Type that has json_parser_description and to_json_data
+		/// function overloads
+		/// @param value value to serialize
+		/// @return std::string with JSON representation of value
+		template<typename JsonClass = use_default, typename Value,
+		         auto... PolicyFlags>
+		[[nodiscard]] std::string to_json_exact(
+		  Value const &value,
+		  options::output_flags_t<PolicyFlags...> = options::output_flags<> );
+
+		/// @brief Serialize a container to a std::string allocated once with the
+		/// exact size from to_json_array_size
+		/// @tparam Container Type of Container to serialize the elements of
+		/// @param c Container containing data to serialize
+		/// @return A std::string containing the serialized elements of c
+		template<typename JsonElement = use_default, typename Container,
+		         auto... PolicyFlags>
+		[[nodiscard]] std::string to_json_array_exact(
+		  Container const &c,
+		  options::output_flags_t<PolicyFlags...> = options::output_flags<> );
 	} // namespace DAW_JSON_VER
 } // namespace daw::json
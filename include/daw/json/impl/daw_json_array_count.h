@@ -0,0 +1,35 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#pragma once
+
+#include "version.h"
+
+#include "daw_json_exec_modes.h"
+#include "daw_json_skip_bracketed.h"
+
+#include <cstddef>
+
+namespace daw::json {
+	inline namespace DAW_JSON_VER {
+		namespace json_details {
+			/***
+			 * Count the elements of the array starting at first, the character
+			 * after the opening bracket, from the top level commas found by
+			 * skip_bracketed_blocks.  The array must not be empty.  The result is
+			 * only used to size the container, a malformed array is reported by
+			 * the parse that follows.
+			 */
+			template<typename ExecTag>
+			std::size_t count_array_elements( ExecTag tag, char const *first,
+			                                  char const *const last ) {
+				return skip_bracketed_blocks<'['>( tag, first, last ).commas + 1U;
+			}
+		} // namespace json_details
+	} // namespace DAW_JSON_VER
+} // namespace daw::json
@@ -0,0 +1,79 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#pragma once
+
+#include "version.h"
+
+#include <daw/daw_attributes.h>
+
+#if defined( DAW_JSON_HAS_RUNTIME_CPU_DISPATCH ) and defined( _MSC_VER )
+#include <intrin.h>
+#endif
+
+namespace daw::json {
+	inline namespace DAW_JSON_VER {
+		namespace json_details {
+			/***
+			 * The widest SIMD instruction set that the best_available exec mode will
+			 * dispatch to
+			 */
+			enum class simd_level : unsigned { none, avx2, avx512 };
+
+			[[nodiscard]] inline simd_level detect_simd_level( ) {
+#if defined( DAW_JSON_HAS_RUNTIME_CPU_DISPATCH )
+#if defined( _MSC_VER )
+				int regs[4]{ };
+				__cpuid( regs, 0 );
+				if( regs[0] < 7 ) {
+					return simd_level::none;
+				}
+				__cpuid( regs, 1 );
+				// OSXSAVE and AVX
+				constexpr int osxsave_avx = ( 1 << 27 ) | ( 1 << 28 );
+				if( ( regs[2] & osxsave_avx ) != osxsave_avx ) {
+					return simd_level::none;
+				}
+				auto const xcr0 = _xgetbv( 0 );
+				// The OS saves the XMM and YMM registers
+				if( ( xcr0 & 0x6U ) != 0x6U ) {
+					return simd_level::none;
+				}
+				__cpuidex( regs, 7, 0 );
+				bool const has_avx2 = ( regs[1] & ( 1 << 5 ) ) != 0;
+				bool const has_avx512 = ( ( regs[1] & ( 1 << 16 ) ) != 0 ) and
+				                        ( ( regs[1] & ( 1 << 30 ) ) != 0 ) and
+				                        // The OS saves the opmask and ZMM registers
+				                        ( ( xcr0 & 0xE6U ) == 0xE6U );
+#else
+				__builtin_cpu_init( );
+				bool const has_avx2 = __builtin_cpu_supports( "avx2" );
+				bool const has_avx512 = __builtin_cpu_supports( "avx512f" ) and
+				                        __builtin_cpu_supports( "avx512bw" );
+#endif
+				if( has_avx512 ) {
+					return simd_level::avx512;
+				}
+				if( has_avx2 ) {
+					return simd_level::avx2;
+				}
+#endif
+				return simd_level::none;
+			}
+
+			/***
+			 * The SIMD level of the host.  It is detected on first use and cached
+			 * for the life of the program
+			 */
+			[[nodiscard]] DAW_ATTRIB_INLINE simd_level best_simd_level( ) {
+				static simd_level const level = detect_simd_level( );
+				return level;
+			}
+		} // namespace json_details
+	} // namespace DAW_JSON_VER
+} // namespace daw::json
@@ -35,6 +35,15 @@ namespace daw::json {
 
 			template<typename T>
 			inline constexpr bool is_std_allocator_v<std::allocator<T>> = true;
+
+			/***
+			 * Passed to a Constructor after the iterators when the number of
+			 * elements in the array was counted before parsing.  See
+			 * options::ExactArraySizing
+			 */
+			struct element_count_hint {
+				std::size_t count;
+			};
 		} // namespace json_details
 
 		/// @brief Default constructor type for std::array and allows (Iterator,
@@ -142,6 +151,20 @@ namespace daw::json {
 					return result;
 				}
 			}
+
+			template<typename Iterator, typename Last>
+			DAW_ATTRIB_INLINE
+			  DAW_JSON_CPP23_STATIC_CALL_OP DAW_JSON_CX_VECTOR std::vector<T, Alloc>
+			  operator( )( Iterator first, Last last,
+			               json_details::element_count_hint hint,
+			               Alloc const &alloc = Alloc{ } )
+			    DAW_JSON_CPP23_STATIC_CALL_OP_CONST {
+				auto result = std::vector<T, Alloc>( alloc );
+				result.reserve( hint.count );
+				result.assign_range( json_details::iter_range_t{ std::move( first ),
+				                                                 std::move( last ) } );
+				return result;
+			}
 			DAW_JSON_CPP23_STATIC_CALL_OP_ENABLE_WARNING
 		};
 
@@ -179,6 +202,19 @@ namespace daw::json {
 					return result;
 				}
 			}
+
+			template<typename Iterator, typename Last>
+			DAW_ATTRIB_INLINE
+			  DAW_JSON_CPP23_STATIC_CALL_OP DAW_JSON_CX_VECTOR std::vector<T, Alloc>
+			  operator( )( Iterator first, Last last,
+			               json_details::element_count_hint hint,
+			               Alloc const &alloc = Alloc{ } )
+			    DAW_JSON_CPP23_STATIC_CALL_OP_CONST {
+				auto result = std::vector<T, Alloc>( alloc );
+				result.reserve( hint.count );
+				result.assign( std::move( first ), std::move( last ) );
+				return result;
+			}
 			DAW_JSON_CPP23_STATIC_CALL_OP_ENABLE_WARNING
 		};
 #endif
@@ -0,0 +1,373 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#pragma once
+
+#include "version.h"
+
+#include "daw_json_cpu_features.h"
+#include "daw_json_exec_modes.h"
+#include "daw_not_const_ex_functions.h"
+
+#include <daw/daw_attributes.h>
+#include <daw/daw_traits.h>
+#include <daw/daw_uint_buffer.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace daw::json {
+	inline namespace DAW_JSON_VER {
+		namespace json_details {
+			template<typename Container>
+			using data_ptr_test =
+			  decltype( std::data( std::declval<Container const &>( ) ) );
+
+			/// The characters of the container are contiguous and can be scanned
+			/// with find_escape
+			template<typename Container>
+			inline constexpr bool is_contiguous_char_range_v = std::is_same_v<
+			  daw::detected_t<data_ptr_test, Container>, char const *>;
+
+			/***
+			 * Does the character need more than a copy when serialized in a JSON
+			 * string.  When escape_high is true, DEL and all bytes with the high bit
+			 * set are flagged too so that they can be escaped or validated
+			 */
+			template<bool escape_high>
+			DAW_ATTRIB_INLINE constexpr bool needs_escape( char c ) {
+				auto const u = static_cast<unsigned char>( c );
+				if constexpr( escape_high ) {
+					if( u >= 0x7FU ) {
+						return true;
+					}
+				}
+				return u < 0x20U or u == '"' or u == '\\';
+			}
+
+			/// Set the high bit of each byte of w that needs_escape flags.  The
+			/// lowest flagged byte is exact, the bytes above it may be false
+			/// positives from the borrow of the subtraction
+			template<bool escape_high>
+			DAW_ATTRIB_INLINE constexpr std::uint64_t
+			swar_escape_flags( std::uint64_t w ) {
+				constexpr std::uint64_t ones = 0x0101'0101'0101'0101ULL;
+				constexpr std::uint64_t highs = 0x8080'8080'8080'8080ULL;
+				auto const has_zero = []( std::uint64_t v ) {
+					return ( v - ones ) & ~v & highs;
+				};
+				std::uint64_t result = has_zero( w ^ ( ones * '"' ) ) |
+				                       has_zero( w ^ ( ones * '\\' ) ) |
+				                       ( ( w - ones * 0x20U ) & ~w & highs );
+				if constexpr( escape_high ) {
+					// The low 7 bits are 0x7F only when adding one carries into the
+					// high bit
+					result |= ( w | ( ( w & ~highs ) + ones ) ) & highs;
+				}
+				return result;
+			}
+
+			/// The constexpr exec mode cannot use memcpy, the words are assembled
+			/// with to_uint64_buffer instead
+			template<bool escape_high>
+			inline constexpr char const *find_escape( constexpr_exec_tag,
+			                                          char const *first,
+			                                          char const *const last ) {
+				while( last - first >= 8 and
+				       swar_escape_flags<escape_high>( static_cast<std::uint64_t>(
+				         daw::to_uint64_buffer( first ) ) ) == 0 ) {
+					first += 8;
+				}
+				while( first < last and not needs_escape<escape_high>( *first ) ) {
+					++first;
+				}
+				return first;
+			}
+
+			template<bool escape_high>
+			inline char const *find_escape( runtime_exec_tag, char const *first,
+			                                char const *const last ) {
+				while( last - first >= 8 ) {
+					std::uint64_t w;
+					std::memcpy( &w, first, sizeof( w ) );
+					if( swar_escape_flags<escape_high>( w ) != 0 ) {
+						break;
+					}
+					first += 8;
+				}
+				while( first < last and not needs_escape<escape_high>( *first ) ) {
+					++first;
+				}
+				return first;
+			}
+
+#if defined( DAW_JSON_HAS_RUNTIME_CPU_DISPATCH )
+			template<bool escape_high>
+			DAW_JSON_TARGET_AVX2 inline std::uint32_t
+			find_escape32( avx2_exec_tag, __m256i b ) {
+				__m256i found =
+				  _mm256_or_si256( _mm256_cmpeq_epi8( b, _mm256_set1_epi8( '"' ) ),
+				                   _mm256_cmpeq_epi8( b, _mm256_set1_epi8( '\\' ) ) );
+				// Unsigned b < 0x20 is min( b, 0x1F ) == b
+				__m256i const ctrl_max = _mm256_set1_epi8( 0x1F );
+				found = _mm256_or_si256(
+				  found, _mm256_cmpeq_epi8( _mm256_min_epu8( b, ctrl_max ), b ) );
+				if constexpr( escape_high ) {
+					// The high bytes are negative, DEL is the largest positive byte
+					__m256i const del = _mm256_set1_epi8( 0x7F );
+					found = _mm256_or_si256(
+					  found,
+					  _mm256_or_si256( _mm256_cmpgt_epi8( _mm256_setzero_si256( ), b ),
+					                   _mm256_cmpeq_epi8( b, del ) ) );
+				}
+				return static_cast<std::uint32_t>( _mm256_movemask_epi8( found ) );
+			}
+
+			template<bool escape_high>
+			DAW_JSON_TARGET_AVX2 inline std::uint64_t
+			find_escape64( avx2_exec_tag tag, char const *ptr ) {
+				std::uint32_t const lo = find_escape32<escape_high>(
+				  tag, _mm256_loadu_si256( reinterpret_cast<__m256i const *>( ptr ) ) );
+				std::uint32_t const hi = find_escape32<escape_high>(
+				  tag,
+				  _mm256_loadu_si256( reinterpret_cast<__m256i const *>( ptr + 32 ) ) );
+				return static_cast<std::uint64_t>( lo ) |
+				       ( static_cast<std::uint64_t>( hi ) << 32U );
+			}
+
+			template<bool escape_high>
+			DAW_JSON_TARGET_AVX512 inline std::uint64_t
+			find_escape64( avx512_exec_tag, char const *ptr ) {
+				__m512i const block = _mm512_loadu_si512( ptr );
+				__mmask64 found =
+				  _mm512_cmpeq_epi8_mask( block, _mm512_set1_epi8( '"' ) ) |
+				  _mm512_cmpeq_epi8_mask( block, _mm512_set1_epi8( '\\' ) ) |
+				  _mm512_cmplt_epu8_mask( block, _mm512_set1_epi8( 0x20 ) );
+				if constexpr( escape_high ) {
+					found |= _mm512_cmpge_epu8_mask( block, _mm512_set1_epi8( 0x7F ) );
+				}
+				return static_cast<std::uint64_t>( found );
+			}
+
+			/// The bytes of b shifted up by N within a 256 bit value, with the last
+			/// N bytes of prev shifted in
+			template<int N>
+			DAW_JSON_TARGET_AVX2 inline __m256i utf8_prev32( __m256i b,
+			                                                 __m256i prev ) {
+				return _mm256_alignr_epi8(
+				  b, _mm256_permute2x128_si256( prev, b, 0x21 ), 16 - N );
+			}
+
+			/// The nibble of each byte of b looked up in table
+			DAW_JSON_TARGET_AVX2 inline __m256i utf8_lookup32( __m256i table,
+			                                                   __m256i nibbles ) {
+				return _mm256_shuffle_epi8( table, nibbles );
+			}
+
+			DAW_JSON_TARGET_AVX2 inline __m256i utf8_high_nibbles32( __m256i b ) {
+				return _mm256_and_si256( _mm256_srli_epi16( b, 4 ),
+				                         _mm256_set1_epi8( 0x0F ) );
+			}
+
+			/***
+			 * The bytes of b, preceded by prev, where an invalid UTF-8 sequence is
+			 * detected.  This is the lookup algorithm of Keiser and Lemire,
+			 * "Validating UTF-8 In Less Than One Instruction Per Byte".  Each pair
+			 * of bytes is classified by the nibbles of the first byte and the high
+			 * nibble of the second, the third and fourth bytes of the longer
+			 * sequences are checked separately.  The bits of a byte are nonzero
+			 * when it completes an invalid pair or sequence
+			 */
+			DAW_JSON_TARGET_AVX2 inline __m256i find_utf8_errors32( __m256i b,
+			                                                        __m256i prev ) {
+				constexpr char too_short = 1 << 0;
+				constexpr char too_long = 1 << 1;
+				constexpr char overlong_3 = 1 << 2;
+				constexpr char too_large = 1 << 3;
+				constexpr char surrogate = 1 << 4;
+				constexpr char overlong_2 = 1 << 5;
+				constexpr char too_large_1000 = 1 << 6;
+				constexpr char overlong_4 = 1 << 6;
+				constexpr char two_conts = static_cast<char>( 1 << 7 );
+				constexpr char carry = too_short | too_long | two_conts;
+
+				__m256i const prev1 = utf8_prev32<1>( b, prev );
+				__m256i const byte_1_high = utf8_lookup32(
+				  _mm256_setr_epi8(
+				    // 0_______ ASCII first
+				    too_long, too_long, too_long, too_long, too_long, too_long,
+				    too_long, too_long,
+				    // 10______ continuation first
+				    two_conts, two_conts, two_conts, two_conts,
+				    // 1100____ 1101____ two byte lead
+				    too_short | overlong_2, too_short,
+				    // 1110____ three byte lead
+				    too_short | overlong_3 | surrogate,
+				    // 1111____ four byte lead
+				    too_short | too_large | too_large_1000 | overlong_4,
+				    // The second lane repeats the first
+				    too_long, too_long, too_long, too_long, too_long, too_long,
+				    too_long, too_long, two_conts, two_conts, two_conts, two_conts,
+				    too_short | overlong_2, too_short,
+				    too_short | overlong_3 | surrogate,
+				    too_short | too_large | too_large_1000 | overlong_4 ),
+				  utf8_high_nibbles32( prev1 ) );
+				__m256i const byte_1_low = utf8_lookup32(
+				  _mm256_setr_epi8(
+				    // ____0000 ____0001 ____001_
+				    carry | overlong_3 | overlong_2 | overlong_4, carry | overlong_2,
+				    carry, carry,
+				    // ____0100 ____0101 ____011_
+				    carry | too_large, carry | too_large | too_large_1000,
+				    carry | too_large | too_large_1000,
+				    carry | too_large | too_large_1000,
+				    // ____1___, ____1101 is the surrogate lead 0xED
+				    carry | too_large | too_large_1000,
+				    carry | too_large | too_large_1000,
+				    carry | too_large | too_large_1000,
+				    carry | too_large | too_large_1000,
+				    carry | too_large | too_large_1000,
+				    carry | too_large | too_large_1000 | surrogate,
+				    carry | too_large | too_large_1000,
+				    carry | too_large | too_large_1000,
+				    // The second lane repeats the first
+				    carry | overlong_3 | overlong_2 | overlong_4, carry | overlong_2,
+				    carry, carry, carry | too_large, carry | too_large | too_large_1000,
+				    carry | too_large | too_large_1000,
+				    carry | too_large | too_large_1000,
+				    carry | too_large | too_large_1000,
+				    carry | too_large | too_large_1000,
+				    carry | too_large | too_large_1000,
+				    carry | too_large | too_large_1000,
+				    carry | too_large | too_large_1000,
+				    carry | too_large | too_large_1000 | surrogate,
+				    carry | too_large | too_large_1000,
+				    carry | too_large | too_large_1000 ),
+				  _mm256_and_si256( prev1, _mm256_set1_epi8( 0x0F ) ) );
+				__m256i const byte_2_high = utf8_lookup32(
+				  _mm256_setr_epi8(
+				    // 0_______ ASCII second
+				    too_short, too_short, too_short, too_short, too_short, too_short,
+				    too_short, too_short,
+				    // 1000____
+				    too_long | overlong_2 | two_conts | overlong_3 | too_large_1000 |
+				      overlong_4,
+				    // 1001____
+				    too_long | overlong_2 | two_conts | overlong_3 | too_large,
+				    // 101_____
+				    too_long | overlong_2 | two_conts | surrogate | too_large,
+				    too_long | overlong_2 | two_conts | surrogate | too_large,
+				    // 11______ lead second
+				    too_short, too_short, too_short, too_short,
+				    // The second lane repeats the first
+				    too_short, too_short, too_short, too_short, too_short, too_short,
+				    too_short, too_short,
+				    too_long | overlong_2 | two_conts | overlong_3 | too_large_1000 |
+				      overlong_4,
+				    too_long | overlong_2 | two_conts | overlong_3 | too_large,
+				    too_long | overlong_2 | two_conts | surrogate | too_large,
+				    too_long | overlong_2 | two_conts | surrogate | too_large,
+				    too_short, too_short, too_short, too_short ),
+				  utf8_high_nibbles32( b ) );
+				__m256i const special = _mm256_and_si256(
+				  _mm256_and_si256( byte_1_high, byte_1_low ), byte_2_high );
+				// The third and fourth bytes of a sequence must be continuations.
+				// two_conts flags those and an error when it is not expected
+				__m256i const is_third = _mm256_subs_epu8(
+				  utf8_prev32<2>( b, prev ), _mm256_set1_epi8( 0xE0 - 0x80 ) );
+				__m256i const is_fourth = _mm256_subs_epu8(
+				  utf8_prev32<3>( b, prev ), _mm256_set1_epi8( 0xF0 - 0x80 ) );
+				__m256i const must_be_cont =
+				  _mm256_and_si256( _mm256_or_si256( is_third, is_fourth ),
+				                    _mm256_set1_epi8( two_conts ) );
+				return _mm256_xor_si256( must_be_cont, special );
+			}
+
+			/***
+			 * The bytes of the 64 at ptr that complete an invalid UTF-8 pair or
+			 * sequence.  ptr must be at the start of a character.  A sequence that
+			 * is cut off by the end of the block is not flagged, see
+			 * utf8_cut_tail64
+			 */
+			DAW_JSON_TARGET_AVX2 inline std::uint64_t
+			find_utf8_errors64( avx2_exec_tag, char const *ptr ) {
+				__m256i const lo =
+				  _mm256_loadu_si256( reinterpret_cast<__m256i const *>( ptr ) );
+				__m256i const hi =
+				  _mm256_loadu_si256( reinterpret_cast<__m256i const *>( ptr + 32 ) );
+				__m256i const zero = _mm256_setzero_si256( );
+				__m256i const errors_lo = find_utf8_errors32( lo, zero );
+				__m256i const errors_hi = find_utf8_errors32( hi, lo );
+				auto const ok_lo = static_cast<std::uint32_t>(
+				  _mm256_movemask_epi8( _mm256_cmpeq_epi8( errors_lo, zero ) ) );
+				auto const ok_hi = static_cast<std::uint32_t>(
+				  _mm256_movemask_epi8( _mm256_cmpeq_epi8( errors_hi, zero ) ) );
+				return ~( static_cast<std::uint64_t>( ok_lo ) |
+				          ( static_cast<std::uint64_t>( ok_hi ) << 32U ) );
+			}
+
+			/// The number of bytes at the end of the 64 at ptr that start a UTF-8
+			/// sequence that continues past them
+			inline std::ptrdiff_t utf8_cut_tail64( char const *ptr ) {
+				auto const at = [&]( std::size_t n ) {
+					return static_cast<unsigned char>( ptr[n] );
+				};
+				if( at( 63 ) >= 0xC0U ) {
+					return 1;
+				}
+				if( at( 62 ) >= 0xE0U ) {
+					return 2;
+				}
+				if( at( 61 ) >= 0xF0U ) {
+					return 3;
+				}
+				return 0;
+			}
+
+			template<bool escape_high, typename ExecTag,
+			         std::enable_if_t<is_wide_exec_tag_v<ExecTag>, std::nullptr_t> =
+			           nullptr>
+			inline char const *find_escape( ExecTag tag, char const *first,
+			                                char const *const last ) {
+				while( last - first >= 64 ) {
+					std::uint64_t const found = find_escape64<escape_high>( tag, first );
+					if( found != 0 ) {
+						return first + ctz64( found );
+					}
+					first += 64;
+				}
+				return find_escape<escape_high>( runtime_exec_tag{ }, first, last );
+			}
+#endif
+
+			/// @brief Find the first character in [first, last) that cannot be
+			/// copied as is into a JSON string, using the widest instruction set the
+			/// CPU supports
+			/// @return The position of the character or last
+			template<bool escape_high>
+			inline char const *find_escape( best_available_exec_tag,
+			                                char const *first, char const *last ) {
+#if defined( DAW_JSON_HAS_RUNTIME_CPU_DISPATCH )
+				switch( best_simd_level( ) ) {
+				case simd_level::avx512:
+					return find_escape<escape_high>( avx512_exec_tag{ }, first, last );
+				case simd_level::avx2:
+					return find_escape<escape_high>( avx2_exec_tag{ }, first, last );
+				case simd_level::none:
+					break;
+				}
+#endif
+				return find_escape<escape_high>( runtime_exec_tag{ }, first, last );
+			}
+		} // namespace json_details
+	} // namespace DAW_JSON_VER
+} // namespace daw::json
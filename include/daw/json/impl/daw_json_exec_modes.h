@@ -31,6 +31,31 @@ namespace daw::json {
 #else
 		struct simd_exec_tag : runtime_exec_tag {};
 #endif
+#if defined( DAW_JSON_HAS_RUNTIME_CPU_DISPATCH )
+		/// @brief Use the AVX2 kernels unconditionally.  The host must support
+		/// AVX2
+		struct avx2_exec_tag : runtime_exec_tag {
+			static constexpr std::string_view name = "avx2";
+			static constexpr bool can_constexpr = false;
+		};
+
+		/// @brief Use the AVX512BW kernels unconditionally, falling back to the
+		/// AVX2 kernels where there is no AVX512 specific one.  The host must
+		/// support AVX512F and AVX512BW
+		struct avx512_exec_tag : avx2_exec_tag {
+			static constexpr std::string_view name = "avx512";
+			static constexpr bool can_constexpr = false;
+		};
+#else
+		struct avx2_exec_tag : runtime_exec_tag {};
+		struct avx512_exec_tag : avx2_exec_tag {};
+#endif
+		/// @brief Select the widest kernels the host supports.  The CPU is queried
+		/// once, the first time a kernel is needed
+		struct best_available_exec_tag : runtime_exec_tag {
+			static constexpr std::string_view name = "best_available";
+			static constexpr bool can_constexpr = false;
+		};
 		using default_exec_tag = constexpr_exec_tag;
 	} // namespace DAW_JSON_VER
 } // namespace daw::json
@@ -22,8 +22,10 @@
 #include <daw/daw_string_view.h>
 #include <daw/daw_traits.h>
 #include <daw/daw_uint_buffer.h>
+#include <daw/traits/daw_traits_conditional.h>
 
 #include <cstddef>
+#include <cstdint>
 #include <daw/stdinc/data_access.h>
 
 #if defined( DAW_JSON_PARSER_DIAGNOSTICS )
@@ -96,19 +98,189 @@ namespace daw::json {
 				}
 			};
 
+			/// Classes with at least this many members find names with a hash table
+			/// instead of scanning the hashes
+			inline constexpr std::size_t location_lookup_min_members = 16;
+
+			/// Power of 2 table size with a load factor of at most 0.5
+			DAW_CONSTEVAL std::size_t location_lookup_size( std::size_t count ) {
+				if( count < location_lookup_min_members ) {
+					return 1;
+				}
+				std::size_t result = 1;
+				while( result < 2 * count ) {
+					result *= 2;
+				}
+				return result;
+			}
+
+			DAW_CONSTEVAL unsigned location_lookup_shift( std::size_t table_size ) {
+				unsigned bits = 0;
+				while( ( std::size_t{ 1 } << bits ) < table_size ) {
+					++bits;
+				}
+				return 32U - bits;
+			}
+
+			/// @brief The length of a name combined with the bytes at two offsets.
+			/// Offsets past the end of the name read as 0.  See
+			/// options::MemberNameMatching
+			[[nodiscard]] DAW_ATTRIB_INLINE constexpr UInt32
+			name_signature( daw::string_view key, std::size_t pos0,
+			                std::size_t pos1 ) {
+				auto const sz = std::size( key );
+				auto const byte_at = [&]( std::size_t pos ) {
+					return pos < sz ? static_cast<std::uint32_t>(
+					                    static_cast<unsigned char>( key[pos] ) )
+					                : 0U;
+				};
+				return to_uint32( ( static_cast<std::uint32_t>( sz ) << 16U ) |
+				                  ( byte_at( pos0 ) << 8U ) | byte_at( pos1 ) );
+			}
+
+			struct name_signature_positions {
+				bool found = false;
+				std::uint16_t pos0 = 0;
+				std::uint16_t pos1 = 0;
+			};
+
+			/// Only the first bytes of names are considered to bound the
+			/// compile time search
+			inline constexpr std::size_t name_signature_max_offset = 32;
+
+			/// Classes with more members than this use the hash path without
+			/// searching for signature offsets.  With the offsets above, this bounds
+			/// the search to about 560 candidates of this many names each
+			inline constexpr std::size_t name_signature_max_members = 128;
+
+			/***
+			 * Find the first byte offsets that, with the length, make the
+			 * signature of every member name unique.  A single offset is
+			 * preferred over a pair.  Each candidate is checked by adding the
+			 * signatures to an open addressed set, so that wide classes do not
+			 * compare every pair of names.
+			 */
+			template<typename... JsonMembers>
+			DAW_CONSTEVAL name_signature_positions find_name_signature_positions( ) {
+				constexpr std::size_t count = sizeof...( JsonMembers );
+				if constexpr( count > name_signature_max_members ) {
+					return { };
+				} else {
+					daw::string_view const names[count]{ JsonMembers::name... };
+					std::size_t max_offset = 1;
+					for( auto const &name : names ) {
+						if( std::size( name ) > max_offset ) {
+							max_offset = std::size( name );
+						}
+					}
+					if( max_offset > name_signature_max_offset ) {
+						max_offset = name_signature_max_offset;
+					}
+					// A load factor of at most 0.5
+					constexpr std::size_t set_size = 2 * name_signature_max_members;
+					static_assert( set_size == 256, "The slots use 8 bits of the hash" );
+					auto const is_unique = [&]( std::size_t pos0, std::size_t pos1 ) {
+						std::uint32_t seen[set_size]{ };
+						bool used[set_size]{ };
+						for( auto const &name : names ) {
+							auto const sig = static_cast<std::uint32_t>(
+							  name_signature( name, pos0, pos1 ) );
+							// Fibonacci hashing, the top 8 bits index the set
+							auto slot = static_cast<std::size_t>(
+							  static_cast<std::uint32_t>( sig * 0x9E37'79B1U ) >> 24U );
+							while( used[slot] ) {
+								if( seen[slot] == sig ) {
+									return false;
+								}
+								slot = ( slot + 1 ) & ( set_size - 1 );
+							}
+							used[slot] = true;
+							seen[slot] = sig;
+						}
+						return true;
+					};
+					for( std::size_t pos0 = 0; pos0 < max_offset; ++pos0 ) {
+						if( is_unique( pos0, pos0 ) ) {
+							return { true, static_cast<std::uint16_t>( pos0 ),
+							         static_cast<std::uint16_t>( pos0 ) };
+						}
+					}
+					for( std::size_t pos0 = 0; pos0 < max_offset; ++pos0 ) {
+						for( std::size_t pos1 = pos0 + 1; pos1 < max_offset; ++pos1 ) {
+							if( is_unique( pos0, pos1 ) ) {
+								return { true, static_cast<std::uint16_t>( pos0 ),
+								         static_cast<std::uint16_t>( pos1 ) };
+							}
+						}
+					}
+					return { };
+				}
+			}
+
 			/***
 			 * Contains an array of member location_info mapped in a json_class
 			 * @tparam MemberCount Number of mapped members from json_class
+			 * @tparam UseNameSignature hashes contains name_signature's instead of
+			 * name_hash's
+			 * @tparam UseLookupTable Wide classes find names with the lookup table
+			 * instead of scanning the hashes
 			 */
 			template<std::size_t MemberCount, typename CharT,
-			         bool DoFullNameMatch = true>
+			         bool DoFullNameMatch = true, bool UseNameSignature = false,
+			         bool UseLookupTable = true>
 			struct locations_info_t {
 				using value_type = location_info_t<DoFullNameMatch, CharT>;
 				using reference = value_type &;
 				using const_reference = value_type const &;
 				static constexpr bool do_full_name_match = DoFullNameMatch;
+				static constexpr bool use_name_signature = UseNameSignature;
+				static_assert( not use_name_signature or do_full_name_match,
+				               "Name signatures require a full name match" );
+				static constexpr bool use_lookup_table =
+				  UseLookupTable and MemberCount >= location_lookup_min_members;
+				static constexpr std::size_t lookup_size =
+				  use_lookup_table ? location_lookup_size( MemberCount ) : 1;
+				static constexpr unsigned lookup_shift =
+				  location_lookup_shift( lookup_size );
+				// MemberCount marks an empty slot
+				using lookup_index_t =
+				  daw::conditional_t<( MemberCount < 0xFFU ), std::uint8_t,
+				                     std::uint16_t>;
+				static_assert( MemberCount < 0xFFFFU, "Too many members in class" );
+
 				daw::UInt32 hashes[MemberCount];
 				value_type names[MemberCount];
+				/// Open addressing table of member indices, slotted by hash and
+				/// filled by build_lookup_table
+				lookup_index_t lookup[lookup_size];
+				/// Offsets used by name_signature when use_name_signature
+				std::uint16_t signature_pos0;
+				std::uint16_t signature_pos1;
+
+				/// Fibonacci hashing, so that the slot uses the well mixed high bits
+				/// of the name hash
+				[[nodiscard]] DAW_ATTRIB_INLINE static constexpr std::size_t
+				lookup_slot( UInt32 hash ) {
+					return static_cast<std::size_t>(
+					  static_cast<std::uint32_t>(
+					    static_cast<std::uint32_t>( hash ) * 0x9E37'79B1U ) >>
+					  lookup_shift );
+				}
+
+				constexpr void build_lookup_table( ) {
+					for( auto &l : lookup ) {
+						l = static_cast<lookup_index_t>( MemberCount );
+					}
+					if constexpr( use_lookup_table ) {
+						for( std::size_t n = 0; n < MemberCount; ++n ) {
+							std::size_t slot = lookup_slot( hashes[n] );
+							while( lookup[slot] != MemberCount ) {
+								slot = ( slot + 1 ) & ( lookup_size - 1 );
+							}
+							lookup[slot] = static_cast<lookup_index_t>( n );
+						}
+					}
+				}
 
 				constexpr const_reference operator[]( std::size_t idx ) const {
 					daw_json_ensure( idx < MemberCount, ErrorReason::NumberOutOfRange );
@@ -127,7 +299,39 @@ namespace daw::json {
 				template<bool expect_long_strings, std::size_t start_pos>
 				[[nodiscard]] DAW_ATTRIB_INLINE constexpr std::size_t
 				find_name( daw::string_view key ) const {
-					UInt32 const hash = name_hash<expect_long_strings>( key );
+					UInt32 const hash = [&] {
+						if constexpr( use_name_signature ) {
+							return name_signature( key, signature_pos0, signature_pos1 );
+						} else {
+							return name_hash<expect_long_strings>( key );
+						}
+					}( );
+					if constexpr( use_lookup_table ) {
+#if defined( DAW_JSON_BUGFIX_MSVC_EVAL_ORDER_002 )
+						constexpr std::size_t min_pos = 0;
+#else
+						constexpr std::size_t min_pos = start_pos;
+#endif
+						// The table is at most half full, so there is always an empty
+						// slot to stop at
+						std::size_t slot = lookup_slot( hash );
+						while( true ) {
+							std::size_t const n = lookup[slot];
+							if( n == MemberCount ) {
+								return MemberCount;
+							}
+							if( ( hashes[n] == hash ) & ( n >= min_pos ) ) {
+								if constexpr( do_full_name_match ) {
+									if( DAW_LIKELY( key == names[n].name ) ) {
+										return n;
+									}
+								} else {
+									return n;
+								}
+							}
+							slot = ( slot + 1 ) & ( lookup_size - 1 );
+						}
+					}
 #if defined( DAW_JSON_BUGFIX_MSVC_EVAL_ORDER_002 )
 					(void)start_pos;
 					for( std::size_t n = 0; n < MemberCount; ++n ) {
@@ -164,34 +368,71 @@ namespace daw::json {
 			// Should never be called outside a consteval context
 			template<typename ParseState, typename... JsonMembers>
 			DAW_ATTRIB_FLATINLINE static inline DAW_JSON_MAKE_LOC_INFO_CONSTEVAL auto
-			make_locations_info( ) {
+			make_locations_info_hashed( ) {
 				using CharT = typename ParseState::CharT;
+				constexpr bool use_lookup_table = ParseState::use_member_lookup_table;
 #if defined( DAW_JSON_ALWAYS_FULL_NAME_MATCH )
 				constexpr bool do_full_name_match = true;
-				return locations_info_t<sizeof...( JsonMembers ), CharT,
-				                        do_full_name_match>{
+				auto result = locations_info_t<sizeof...( JsonMembers ), CharT,
+				                               do_full_name_match, false,
+				                               use_lookup_table>{
 				  { daw::name_hash<false>( JsonMembers::name )... },
 				  { location_info_t<do_full_name_match, CharT>{
 				    JsonMembers::name }... } };
+				result.build_lookup_table( );
+				return result;
 #else
 				// DAW
 				constexpr bool do_full_name_match =
 				  ParseState::force_name_equal_check or
 				  do_hashes_collide<JsonMembers...>( );
 				if constexpr( do_full_name_match ) {
-					return locations_info_t<sizeof...( JsonMembers ), CharT,
-					                        do_full_name_match>{
+					auto result = locations_info_t<sizeof...( JsonMembers ), CharT,
+					                               do_full_name_match, false,
+					                               use_lookup_table>{
 					  { daw::name_hash<false>( JsonMembers::name )... },
 					  { location_info_t<do_full_name_match, CharT>{
 					    JsonMembers::name }... } };
+					result.build_lookup_table( );
+					return result;
 				} else {
-					return locations_info_t<sizeof...( JsonMembers ), CharT,
-					                        do_full_name_match>{
+					auto result = locations_info_t<sizeof...( JsonMembers ), CharT,
+					                               do_full_name_match, false,
+					                               use_lookup_table>{
 					  { daw::name_hash<false>( JsonMembers::name )... }, {} };
+					result.build_lookup_table( );
+					return result;
 				}
 #endif
 			}
 
+			// Should never be called outside a consteval context
+			template<typename ParseState, typename... JsonMembers>
+			DAW_ATTRIB_FLATINLINE static inline DAW_JSON_MAKE_LOC_INFO_CONSTEVAL auto
+			make_locations_info( ) {
+				if constexpr( ParseState::use_name_signatures ) {
+					using CharT = typename ParseState::CharT;
+					constexpr auto positions =
+					  find_name_signature_positions<JsonMembers...>( );
+					if constexpr( positions.found ) {
+						auto result = locations_info_t<sizeof...( JsonMembers ), CharT,
+						                               true, true>{
+						  { name_signature( JsonMembers::name, positions.pos0,
+						                    positions.pos1 )... },
+						  { location_info_t<true, CharT>{ JsonMembers::name }... },
+						  { },
+						  positions.pos0,
+						  positions.pos1 };
+						result.build_lookup_table( );
+						return result;
+					} else {
+						return make_locations_info_hashed<ParseState, JsonMembers...>( );
+					}
+				} else {
+					return make_locations_info_hashed<ParseState, JsonMembers...>( );
+				}
+			}
+
 			/***
 			 * Get the position from already seen JSON members or move the parser
 			 * forward until we reach the end of the class or the member.
@@ -205,10 +446,10 @@ namespace daw::json {
 
 			template<std::size_t pos, AllMembersMustExist must_exist,
 			         bool from_start = false, std::size_t N, typename ParseState,
-			         bool B, typename CharT>
+			         bool B, bool S, bool L, typename CharT>
 			[[nodiscard]] DAW_ATTRIB_INLINE static constexpr find_result<ParseState>
 			find_class_member( ParseState &parse_state,
-			                   locations_info_t<N, CharT, B> &locations,
+			                   locations_info_t<N, CharT, B, S, L> &locations,
 			                   bool is_nullable, daw::string_view member_name ) {
 
 				// silencing gcc9 warning as these are selectively used
@@ -0,0 +1,66 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#pragma once
+
+#include "version.h"
+
+#include <daw/daw_attributes.h>
+#include <daw/traits/daw_traits_conditional.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace daw::json {
+	inline namespace DAW_JSON_VER {
+		namespace json_details {
+			/***
+			 * The order that the mapped members of a class were seen in a document.
+			 * Unmapped members are not recorded.  See options::PredictMemberOrder
+			 * @tparam MemberCount Number of mapped members in the class
+			 */
+			template<std::size_t MemberCount>
+			struct member_order_t {
+				using index_t = daw::conditional_t<( MemberCount <= 0xFFU ),
+				                                   std::uint8_t, std::uint16_t>;
+				static_assert( MemberCount <= 0xFFFFU, "Too many members in class" );
+
+				index_t order[MemberCount];
+				std::size_t count = 0;
+
+				/// @brief The member expected at position idx in the document or
+				/// MemberCount when there is no prediction
+				[[nodiscard]] DAW_ATTRIB_INLINE std::size_t
+				predict( std::size_t idx ) const {
+					if( idx < count ) {
+						return order[idx];
+					}
+					return MemberCount;
+				}
+
+				DAW_ATTRIB_INLINE void push_back( std::size_t member_index ) {
+					if( count < MemberCount ) {
+						order[count] = static_cast<index_t>( member_index );
+						++count;
+					}
+				}
+			};
+
+			/***
+			 * The last seen member order of a class, per thread.
+			 * @tparam JsonClass The class the order is for
+			 * @tparam MemberCount Number of mapped members in the class
+			 */
+			template<typename JsonClass, std::size_t MemberCount>
+			[[nodiscard]] member_order_t<MemberCount> &predicted_member_order( ) {
+				static thread_local member_order_t<MemberCount> result{ };
+				return result;
+			}
+		} // namespace json_details
+	} // namespace DAW_JSON_VER
+} // namespace daw::json
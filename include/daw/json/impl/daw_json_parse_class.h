@@ -12,6 +12,7 @@
 
 #include "daw_json_assert.h"
 #include "daw_json_location_info.h"
+#include "daw_json_member_order.h"
 #include "daw_json_name.h"
 #include "daw_json_parse_common.h"
 #include "daw_json_parse_value.h"
@@ -24,7 +25,10 @@
 #include <daw/daw_traits.h>
 
 #include <cstddef>
+#include <optional>
+#include <tuple>
 #include <type_traits>
+#include <utility>
 
 namespace daw::json {
 	inline namespace DAW_JSON_VER {
@@ -92,11 +96,12 @@ namespace daw::json {
 			///
 			template<std::size_t member_position, typename JsonMember,
 			         AllMembersMustExist must_exist, bool NeedsClassPositions,
-			         typename ParseState, std::size_t N, typename CharT, bool B>
+			         typename ParseState, std::size_t N, typename CharT, bool B,
+			         bool S, bool L>
 			[[nodiscard]] DAW_ATTRIB_FLATINLINE static constexpr json_result_t<
 			  JsonMember>
 			parse_class_member( ParseState &parse_state,
-			                    locations_info_t<N, CharT, B> &locations ) {
+			                    locations_info_t<N, CharT, B, S, L> &locations ) {
 				parse_state.move_next_member_or_end( );
 
 				daw_json_assert_weak(
@@ -172,6 +177,129 @@ namespace daw::json {
 				parse_state.set_class_position( old_class_pos );
 			}
 
+			/// Classes can be parsed in document order when the members can be
+			/// stored until the class is constructed.  See
+			/// options::PredictMemberOrder
+			template<typename... JsonMembers>
+			inline constexpr bool can_parse_in_document_order_v =
+			  ( ( std::is_move_constructible_v<json_result_t<JsonMembers>> and
+			      not must_be_class_member_v<without_name<JsonMembers>> ) and
+			    ... );
+
+			template<std::size_t member_position, typename JsonMember,
+			         typename ParseState, typename Values>
+			DAW_ATTRIB_INLINE static constexpr void
+			parse_document_order_member( ParseState &parse_state, Values &values ) {
+				auto &value = std::get<member_position>( values );
+				if( DAW_UNLIKELY( value.has_value( ) ) ) {
+					// Duplicate member, the first one is used like the default parser
+					(void)skip_value( parse_state );
+					return;
+				}
+				value.emplace( parse_value<without_name<JsonMember>, false,
+				                           JsonMember::expected_type>( parse_state ) );
+			}
+
+			template<typename JsonMember, typename ParseState, typename Value>
+			[[nodiscard]] DAW_ATTRIB_INLINE static constexpr json_result_t<JsonMember>
+			take_document_order_member( ParseState &parse_state, Value &value ) {
+				if( DAW_LIKELY( value.has_value( ) ) ) {
+					return std::move( *value );
+				}
+				if constexpr( is_json_nullable_v<JsonMember> ) {
+					auto loc = ParseState{ };
+					return parse_value_null<without_name<JsonMember>, true>( loc );
+				} else {
+					daw_json_error( missing_member( std::string_view(
+					                  std::data( JsonMember::name ),
+					                  std::size( JsonMember::name ) ) ),
+					                parse_state );
+				}
+			}
+
+			///
+			/// @brief Parse the members of a class in the order they appear in the
+			/// document and construct the class after the closing brace.  Names are
+			/// first checked against the order seen in the last document with this
+			/// class, on a miss they are looked up in locations.  See
+			/// options::PredictMemberOrder
+			/// @pre parse_state is after the opening brace of the class
+			/// @post parse_state is after the closing brace of the class
+			///
+			template<typename JsonClass, typename... JsonMembers, typename ParseState,
+			         typename Locations, typename OldClassPos, std::size_t... Is>
+			[[nodiscard]] static json_result_t<JsonClass>
+			parse_json_class_document_order( ParseState &parse_state,
+			                                 Locations const &locations,
+			                                 OldClassPos const &old_class_pos,
+			                                 std::index_sequence<Is...> ) {
+				using T = json_result_t<JsonClass>;
+				using Constructor = json_constructor_t<JsonClass>;
+				constexpr std::size_t member_count = sizeof...( JsonMembers );
+				constexpr daw::string_view member_names[member_count]{
+				  JsonMembers::name... };
+
+				auto &prediction =
+				  predicted_member_order<JsonClass, member_count>( );
+				auto observed = member_order_t<member_count>{ };
+				bool missed = false;
+				auto values =
+				  std::tuple<std::optional<json_result_t<JsonMembers>>...>{ };
+
+				while( parse_state.has_more( ) and parse_state.front( ) != '}' ) {
+					daw_json_assert_weak( parse_state.is_at_next_class_member( ),
+					                      ErrorReason::MissingMemberNameOrEndOfClass,
+					                      parse_state );
+					auto const name = parse_name( parse_state );
+					std::size_t member_index = prediction.predict( observed.count );
+					if( member_index >= member_count or
+					    name != member_names[member_index] ) {
+						missed = true;
+						member_index =
+						  locations.template find_name<ParseState::expect_long_strings, 0>(
+						    name );
+					}
+					if( member_index < member_count ) {
+						observed.push_back( member_index );
+						(void)( ( member_index == Is
+						            ? ( parse_document_order_member<
+						                  Is, daw::traits::nth_type<Is, JsonMembers...>>(
+						                  parse_state, values ),
+						                true )
+						            : false ) or
+						        ... );
+					} else {
+						if constexpr( all_json_members_must_exist_v<T, ParseState> ) {
+							daw_json_error( ErrorReason::UnknownMember, parse_state );
+						} else {
+							(void)skip_value( parse_state );
+						}
+					}
+					parse_state.move_next_member_or_end( );
+				}
+				daw_json_assert_weak( parse_state.has_more( ),
+				                      ErrorReason::UnexpectedEndOfData, parse_state );
+				if( missed or observed.count != prediction.count ) {
+					prediction = observed;
+				}
+				parse_state.remove_prefix( );
+				parse_state.trim_left_checked( );
+				parse_state.set_class_position( old_class_pos );
+
+				if constexpr( should_construct_explicitly_v<Constructor, T,
+				                                            ParseState> ) {
+					return T{ take_document_order_member<
+					  daw::traits::nth_type<Is, JsonMembers...>>(
+					  parse_state, std::get<Is>( values ) )... };
+				} else {
+					return construct_value_tp<T, Constructor>(
+					  parse_state,
+					  fwd_pack{ take_document_order_member<
+					    daw::traits::nth_type<Is, JsonMembers...>>(
+					    parse_state, std::get<Is>( values ) )... } );
+				}
+			}
+
 			///
 			/// @brief Parse to the user supplied class.  The parser will run
 			/// left->right if it can when the JSON document's order matches that of
@@ -227,7 +355,12 @@ namespace daw::json {
 					  ( make_locations_info<ParseState, JsonMembers...>( ) ) );
 #endif
 
-					if constexpr( is_pinned_type_v<json_result_t<JsonClass>> ) {
+					if constexpr( ParseState::predict_member_order and
+					              can_parse_in_document_order_v<JsonMembers...> ) {
+						return parse_json_class_document_order<JsonClass, JsonMembers...>(
+						  parse_state, known_locations, old_class_pos,
+						  std::index_sequence<Is...>{ } );
+					} else if constexpr( is_pinned_type_v<json_result_t<JsonClass>> ) {
 						/// Because the return type is pinned(no copy/move).  We cannot rely
 						/// on NRVO. This requires on_exit_success that on some platforms
 						/// can cost a bunch because it checks std::uncaught_exceptions
@@ -0,0 +1,359 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#pragma once
+
+#include "version.h"
+
+#include "daw_json_assert.h"
+#include "daw_json_default_constuctor.h"
+#include "daw_json_location_info.h"
+#include "daw_json_parse_class.h"
+#include "daw_json_parse_common.h"
+#include "daw_json_parse_name.h"
+#include "daw_json_parse_std_string.h"
+#include "daw_json_parse_value.h"
+#include "daw_json_skip.h"
+#include "daw_json_traits.h"
+
+#include <daw/daw_attributes.h>
+#include <daw/daw_data_end.h>
+#include <daw/daw_likely.h>
+#include <daw/daw_traits.h>
+
+#include <cstddef>
+#include <iterator>
+#include <optional>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace daw::json {
+	inline namespace DAW_JSON_VER {
+		namespace json_details {
+			/***
+			 * The tuple returned by to_json_data refers to each mapped member of the
+			 * class with the type that the mapping parses to
+			 */
+			template<typename... JsonMembers, typename... Refs>
+			constexpr bool are_class_member_refs( std::tuple<Refs...> const * ) {
+				if constexpr( sizeof...( Refs ) != sizeof...( JsonMembers ) ) {
+					return false;
+				} else {
+					return ( ( std::is_lvalue_reference_v<Refs> and
+					           std::is_same_v<daw::remove_cvref_t<Refs>,
+					                          json_result_t<JsonMembers>> and
+					           not must_be_class_member_v<without_name<JsonMembers>> ) and
+					         ... );
+				}
+			}
+
+			template<typename... JsonMembers>
+			constexpr bool are_class_member_refs( void const * ) {
+				return false;
+			}
+
+			/***
+			 * An existing class can be parsed into when it is built by the default
+			 * constructor from its members and to_json_data returns references to
+			 * those members.  Otherwise the parsed value is assigned to it.  See
+			 * from_json_into
+			 */
+			template<typename JsonClass, typename... JsonMembers>
+			constexpr bool can_parse_class_members_into( ) {
+				using T = json_result_t<JsonClass>;
+				if constexpr( not has_json_to_json_data_v<T> or
+				              is_pinned_type_v<T> or
+				              not std::is_move_assignable_v<T> or
+				              not std::is_same_v<json_constructor_t<JsonClass>,
+				                                 default_constructor<T>> ) {
+					return false;
+				} else {
+					using refs_t = daw::remove_cvref_t<decltype(
+					  json_data_contract<T>::to_json_data( std::declval<T &>( ) ) )>;
+					return are_class_member_refs<JsonMembers...>(
+					  static_cast<refs_t const *>( nullptr ) );
+				}
+			}
+
+			template<typename JsonMember, typename = void>
+			inline constexpr bool can_parse_class_into_v = false;
+
+			template<typename JsonMember>
+			inline constexpr bool can_parse_class_into_v<
+			  JsonMember,
+			  std::void_t<decltype( json_data_contract_trait_t<json_result_t<
+			                          JsonMember>>::template can_parse_into_v<
+			                          JsonMember> )>> =
+			  json_data_contract_trait_t<
+			    json_result_t<JsonMember>>::template can_parse_into_v<JsonMember>;
+
+			template<typename JsonMember, typename T, typename = void>
+			inline constexpr bool can_parse_array_into_v = false;
+
+			template<typename JsonMember, typename T, typename Allocator>
+			inline constexpr bool can_parse_array_into_v<
+			  JsonMember, std::vector<T, Allocator>,
+			  std::void_t<typename JsonMember::json_element_t>> =
+			  not std::is_same_v<T, bool> and
+			  std::is_same_v<json_result_t<JsonMember>, std::vector<T, Allocator>> and
+			  std::is_same_v<json_constructor_t<JsonMember>,
+			                 default_constructor<std::vector<T, Allocator>>> and
+			  std::is_same_v<json_result_t<typename JsonMember::json_element_t>, T>;
+
+			template<typename JsonMember, typename T>
+			inline constexpr bool can_parse_string_into_v = false;
+
+			template<typename JsonMember, typename CharTrait, typename Allocator>
+			inline constexpr bool can_parse_string_into_v<
+			  JsonMember, std::basic_string<char, CharTrait, Allocator>> =
+			  can_parse_to_stdstring_fast_v<JsonMember> and
+			  std::is_same_v<json_result_t<JsonMember>,
+			                 std::basic_string<char, CharTrait, Allocator>>;
+
+			template<typename JsonMember, typename T, typename = void>
+			inline constexpr bool can_parse_nullable_into_v = false;
+
+			template<typename JsonMember, typename T>
+			inline constexpr bool can_parse_nullable_into_v<
+			  JsonMember, std::optional<T>,
+			  std::void_t<typename JsonMember::member_type>> =
+			  std::is_same_v<json_result_t<JsonMember>, std::optional<T>> and
+			  std::is_same_v<json_result_t<typename JsonMember::member_type>, T>;
+
+			template<typename JsonMember, typename ParseState, typename T>
+			constexpr void parse_value_into( ParseState &parse_state, T &target );
+
+			/// to_json_data commonly returns const references, the members of the
+			/// value being parsed into are not const.  See
+			/// can_parse_class_members_into
+			template<typename T>
+			DAW_ATTRIB_INLINE constexpr T &as_parse_target( T const &value ) {
+				return const_cast<T &>( value );
+			}
+
+			template<typename JsonMember, typename ParseState, typename T>
+			DAW_ATTRIB_INLINE constexpr void
+			parse_missing_member_into( ParseState &parse_state, T &target ) {
+				if constexpr( is_json_nullable_v<JsonMember> ) {
+					auto loc = ParseState{ };
+					target = parse_value_null<without_name<JsonMember>, true>( loc );
+				} else {
+					daw_json_error( missing_member( std::string_view(
+					                  std::data( JsonMember::name ),
+					                  std::size( JsonMember::name ) ) ),
+					                parse_state );
+				}
+			}
+
+			///
+			/// @brief Parse the members of a class in document order directly into
+			/// the members of value.  Members missing from the document are reset
+			/// like the class parser would construct them.
+			/// @pre can_parse_class_members_into<JsonClass, JsonMembers...>( )
+			/// @post parse_state is after the closing brace of the class
+			///
+			template<typename JsonClass, typename... JsonMembers, typename ParseState,
+			         std::size_t... Is>
+			static constexpr void
+			parse_json_class_into( ParseState &parse_state,
+			                       json_result_t<JsonClass> &value,
+			                       std::index_sequence<Is...> ) {
+				using T = json_result_t<JsonClass>;
+				constexpr std::size_t member_count = sizeof...( JsonMembers );
+
+				parse_state.trim_left( );
+				daw_json_assert_weak( parse_state.is_opening_brace_checked( ),
+				                      ErrorReason::InvalidClassStart, parse_state );
+
+				auto const old_class_pos = parse_state.get_class_position( );
+				parse_state.set_class_position( );
+				parse_state.remove_prefix( );
+				parse_state.trim_left( );
+
+				if constexpr( member_count == 0 ) {
+					class_cleanup_now<all_json_members_must_exist_v<T, ParseState>>(
+					  parse_state, old_class_pos );
+				} else {
+					auto const members = json_data_contract<T>::to_json_data( value );
+#if defined( DAW_JSON_BUGFIX_MSVC_KNOWN_LOC_ICE_003 )
+					auto known_locations =
+					  make_locations_info<ParseState, JsonMembers...>( );
+#else
+					auto known_locations = DAW_AS_CONSTANT(
+					  ( make_locations_info<ParseState, JsonMembers...>( ) ) );
+#endif
+					bool seen[member_count]{ };
+
+					while( parse_state.has_more( ) and parse_state.front( ) != '}' ) {
+						daw_json_assert_weak( parse_state.is_at_next_class_member( ),
+						                      ErrorReason::MissingMemberNameOrEndOfClass,
+						                      parse_state );
+						auto const name = parse_name( parse_state );
+						std::size_t const member_index =
+						  known_locations
+						    .template find_name<ParseState::expect_long_strings, 0>( name );
+						if( member_index < member_count ) {
+							if( DAW_UNLIKELY( seen[member_index] ) ) {
+								// Duplicate member, the first one is used like the default
+								// parser
+								(void)skip_value( parse_state );
+							} else {
+								seen[member_index] = true;
+								(void)( ( member_index == Is
+								            ? ( parse_value_into<without_name<
+								                  daw::traits::nth_type<Is, JsonMembers...>>>(
+								                  parse_state,
+								                  as_parse_target( std::get<Is>( members ) ) ),
+								                true )
+								            : false ) or
+								        ... );
+							}
+						} else {
+							if constexpr( all_json_members_must_exist_v<T, ParseState> ) {
+								daw_json_error( ErrorReason::UnknownMember, parse_state );
+							} else {
+								(void)skip_value( parse_state );
+							}
+						}
+						parse_state.move_next_member_or_end( );
+					}
+					daw_json_assert_weak( parse_state.has_more( ),
+					                      ErrorReason::UnexpectedEndOfData, parse_state );
+					parse_state.remove_prefix( );
+					parse_state.trim_left_checked( );
+					parse_state.set_class_position( old_class_pos );
+
+					( ( seen[Is] ? void( )
+					             : parse_missing_member_into<
+					                 daw::traits::nth_type<Is, JsonMembers...>>(
+					                 parse_state,
+					                 as_parse_target( std::get<Is>( members ) ) ) ),
+					  ... );
+				}
+			}
+
+			///
+			/// @brief Parse a JSON array into an existing vector.  The elements that
+			/// are already there are parsed into, the rest are appended, and any
+			/// left over are erased.  The capacity is kept.
+			///
+			template<typename JsonMember, typename ParseState, typename Vector>
+			constexpr void parse_array_into( ParseState &parse_state,
+			                                 Vector &target ) {
+				using element_t = typename JsonMember::json_element_t;
+				parse_state.trim_left( );
+				daw_json_assert_weak( parse_state.is_opening_bracket_checked( ),
+				                      ErrorReason::InvalidArrayStart, parse_state );
+				parse_state.remove_prefix( );
+				parse_state.trim_left_unchecked( );
+
+				std::size_t count = 0;
+				daw_json_assert_weak( parse_state.has_more( ),
+				                      ErrorReason::UnexpectedEndOfData, parse_state );
+				while( parse_state.front( ) != ']' ) {
+					if( count < target.size( ) ) {
+						parse_value_into<element_t>( parse_state, target[count] );
+					} else {
+						target.push_back(
+						  parse_value<element_t, false, element_t::expected_type>(
+						    parse_state ) );
+					}
+					++count;
+					parse_state.trim_left( );
+					daw_json_assert_weak( parse_state.has_more( ) and
+					                        parse_state.is_at_next_array_element( ),
+					                      ErrorReason::UnexpectedEndOfData, parse_state );
+					parse_state.move_next_member_or_end( );
+					daw_json_assert_weak( parse_state.has_more( ),
+					                      ErrorReason::UnexpectedEndOfData, parse_state );
+				}
+				parse_state.remove_prefix( );
+				parse_state.trim_left_checked( );
+				target.erase( std::next( target.begin( ),
+				                         static_cast<std::ptrdiff_t>( count ) ),
+				              target.end( ) );
+			}
+
+			///
+			/// @brief Parse a JSON string into an existing std::string, keeping its
+			/// capacity when the decoded string fits
+			///
+			template<typename JsonMember, typename ParseState, typename String>
+			constexpr void parse_string_into( ParseState &parse_state,
+			                                  String &target ) {
+				using AllowHighEightbits =
+				  std::bool_constant<JsonMember::eight_bit_mode !=
+				                     options::EightBitModes::DisallowHigh>;
+				daw_json_ensure( not parse_state.empty( ),
+				                 ErrorReason::UnexpectedNull );
+				auto parse_state2 = skip_string( parse_state );
+				if constexpr( ParseState::unescape_in_place ) {
+					if( needs_slow_path( parse_state2 ) ) {
+						char const *const last =
+						  unescape_string_in_place<AllowHighEightbits::value>(
+						    parse_state2 );
+						target.assign( std::data( parse_state2 ), last );
+						return;
+					}
+				}
+				if( not AllowHighEightbits::value or
+				    needs_slow_path( parse_state2 ) ) {
+					// The decoded string is never longer than the escaped one
+					target.resize( std::size( parse_state2 ) + 1 );
+					char *const first = std::data( target );
+					char *const last =
+					  decode_escaped_string<AllowHighEightbits::value, true>(
+					    parse_state2, first, daw::data_end( target ) );
+					target.resize( static_cast<std::size_t>( last - first ) );
+					return;
+				}
+				target.assign( std::data( parse_state2 ),
+				               daw::data_end( parse_state2 ) );
+			}
+
+			///
+			/// @brief Parse the JSON value into target, reusing the storage
+			/// target already owns where the mapping allows it.  Values that cannot
+			/// be parsed into are parsed and assigned.  See from_json_into
+			///
+			template<typename JsonMember, typename ParseState, typename T>
+			constexpr void parse_value_into( ParseState &parse_state, T &target ) {
+				constexpr JsonParseTypes PTag = JsonMember::expected_type;
+				if constexpr( PTag == JsonParseTypes::Class and
+				              can_parse_class_into_v<JsonMember> ) {
+					daw_json_assert_weak( parse_state.has_more( ),
+					                      ErrorReason::UnexpectedEndOfData, parse_state );
+					json_data_contract_trait_t<json_result_t<JsonMember>>::
+					  template parse_to_class_into<JsonMember>( parse_state, target );
+					parse_state.trim_left_checked( );
+				} else if constexpr( PTag == JsonParseTypes::Array and
+				                     can_parse_array_into_v<JsonMember, T> ) {
+					parse_array_into<JsonMember>( parse_state, target );
+				} else if constexpr( PTag == JsonParseTypes::StringEscaped and
+				                     can_parse_string_into_v<JsonMember, T> ) {
+					parse_string_into<JsonMember>( parse_state, target );
+				} else if constexpr( PTag == JsonParseTypes::Null and
+				                     can_parse_nullable_into_v<JsonMember, T> ) {
+					if( target.has_value( ) and parse_state.has_more( ) and
+					    not parse_state.is_at_token_after_value( ) and
+					    parse_state.front( ) != 'n' ) {
+						parse_value_into<typename JsonMember::member_type>( parse_state,
+						                                                    *target );
+					} else {
+						target = parse_value<JsonMember, false, PTag>( parse_state );
+					}
+				} else {
+					target = parse_value<JsonMember, false, PTag>( parse_state );
+				}
+			}
+		} // namespace json_details
+	} // namespace DAW_JSON_VER
+} // namespace daw::json
@@ -35,6 +35,12 @@ namespace daw::json {
 					return "runtime";
 				case ExecModeTypes::simd:
 					return "simd";
+				case ExecModeTypes::avx2:
+					return "avx2";
+				case ExecModeTypes::avx512:
+					return "avx512";
+				case ExecModeTypes::best_available:
+					return "best_available";
 				}
 				DAW_UNREACHABLE( );
 			}
@@ -43,7 +49,7 @@ namespace daw::json {
 		namespace json_details {
 			template<>
 			inline constexpr unsigned json_option_bits_width<options::ExecModeTypes> =
-			  2;
+			  3;
 
 			template<>
 			inline constexpr auto default_json_option_value<options::ExecModeTypes> =
@@ -158,13 +164,70 @@ namespace daw::json {
 			  default_json_option_value<options::ExcludeSpecialEscapes> =
 			    options::ExcludeSpecialEscapes::no;
 
+			template<>
+			inline constexpr unsigned
+			  json_option_bits_width<options::SkipWithStructuralIndex> = 1;
+
+			template<>
+			inline constexpr auto
+			  default_json_option_value<options::SkipWithStructuralIndex> =
+			    options::SkipWithStructuralIndex::no;
+
+			template<>
+			inline constexpr unsigned
+			  json_option_bits_width<options::MemberNameMatching> = 2;
+
+			template<>
+			inline constexpr auto
+			  default_json_option_value<options::MemberNameMatching> =
+			    options::MemberNameMatching::hash;
+
+			template<>
+			inline constexpr unsigned
+			  json_option_bits_width<options::PredictMemberOrder> = 1;
+
+			template<>
+			inline constexpr auto
+			  default_json_option_value<options::PredictMemberOrder> =
+			    options::PredictMemberOrder::no;
+
+			template<>
+			inline constexpr unsigned
+			  json_option_bits_width<options::UnescapeInPlace> = 1;
+
+			template<>
+			inline constexpr auto
+			  default_json_option_value<options::UnescapeInPlace> =
+			    options::UnescapeInPlace::no;
+
+			template<>
+			inline constexpr unsigned
+			  json_option_bits_width<options::ExactArraySizing> = 1;
+
+			template<>
+			inline constexpr auto
+			  default_json_option_value<options::ExactArraySizing> =
+			    options::ExactArraySizing::no;
+
+			template<>
+			inline constexpr unsigned
+			  json_option_bits_width<options::ValidateUTF8> = 1;
+
+			template<>
+			inline constexpr auto
+			  default_json_option_value<options::ValidateUTF8> =
+			    options::ValidateUTF8::no;
+
 			using policy_list = typename option_list_impl<
 			  options::ExecModeTypes, options::ZeroTerminatedString,
 			  options::PolicyCommentTypes, options::CheckedParseMode,
 			  options::AllowEscapedNames, options::IEEE754Precise,
 			  options::ForceFullNameCheck, options::MinifiedDocument,
 			  options::UseExactMappingsByDefault, options::MustVerifyEndOfDataIsValid,
-			  options::ExcludeSpecialEscapes, options::ExpectLongNames>::type;
+			  options::ExcludeSpecialEscapes, options::ExpectLongNames,
+			  options::SkipWithStructuralIndex, options::MemberNameMatching,
+			  options::PredictMemberOrder, options::UnescapeInPlace,
+			  options::ExactArraySizing, options::ValidateUTF8>::type;
 
 			template<typename Policy, typename Policies>
 			inline constexpr unsigned basic_policy_bits_start =
@@ -84,7 +84,8 @@ namespace daw::json {
 			using exec_tag_t =
 			  switch_t<json_details::get_bits_for<options::ExecModeTypes,
 			                                      std::size_t>( PolicyFlags ),
-			           constexpr_exec_tag, runtime_exec_tag, simd_exec_tag>;
+			           constexpr_exec_tag, runtime_exec_tag, simd_exec_tag,
+			           avx2_exec_tag, avx512_exec_tag, best_available_exec_tag>;
 
 			static constexpr exec_tag_t exec_tag = exec_tag_t{ };
 
@@ -145,17 +146,76 @@ namespace daw::json {
 			  json_details::get_bits_for<options::ExpectLongNames>( PolicyFlags ) ==
 			  options::ExpectLongNames::yes;
 
+			/***
+			 * See options::MemberNameMatching
+			 */
+			static constexpr bool use_name_signatures =
+			  json_details::get_bits_for<options::MemberNameMatching>(
+			    PolicyFlags ) == options::MemberNameMatching::length_and_bytes;
+
+			/***
+			 * See options::MemberNameMatching
+			 */
+			static constexpr bool use_member_lookup_table =
+			  json_details::get_bits_for<options::MemberNameMatching>(
+			    PolicyFlags ) != options::MemberNameMatching::hash_linear_scan;
+
+			/***
+			 * See options::PredictMemberOrder
+			 */
+			static constexpr bool predict_member_order =
+			  json_details::get_bits_for<options::PredictMemberOrder>(
+			    PolicyFlags ) == options::PredictMemberOrder::yes;
+
+			/***
+			 * See options::UnescapeInPlace
+			 */
+			static constexpr bool unescape_in_place =
+			  json_details::get_bits_for<options::UnescapeInPlace>( PolicyFlags ) ==
+			  options::UnescapeInPlace::yes;
+
+			/***
+			 * See options::ExactArraySizing
+			 */
+			static constexpr bool exact_array_sizing =
+			  json_details::get_bits_for<options::ExactArraySizing>( PolicyFlags ) ==
+			  options::ExactArraySizing::yes;
+
+			/***
+			 * See options::ValidateUTF8
+			 */
+			static constexpr bool validate_utf8 =
+			  json_details::get_bits_for<options::ValidateUTF8>( PolicyFlags ) ==
+			  options::ValidateUTF8::yes;
+
+			/***
+			 * See options::SkipWithStructuralIndex
+			 */
+			static constexpr bool skip_with_structural_index =
+			  json_details::get_bits_for<options::SkipWithStructuralIndex>(
+			    PolicyFlags ) == options::SkipWithStructuralIndex::yes;
+
 			using CommentPolicy =
 			  switch_t<json_details::get_bits_for<options::PolicyCommentTypes,
 			                                      std::size_t>( PolicyFlags ),
 			           NoCommentSkippingPolicy, CppCommentSkippingPolicy,
 			           HashCommentSkippingPolicy>;
 
+			static_assert(
+			  not skip_with_structural_index or
+			    std::is_same_v<CommentPolicy, NoCommentSkippingPolicy>,
+			  "options::SkipWithStructuralIndex cannot be used with comment "
+			  "policies" );
+
 			iterator first{ };
 			iterator last{ };
 			iterator class_first{ };
 			iterator class_last{ };
 			std::size_t counter = 0;
+			/// Set by from_json and from_json_array when
+			/// options::SkipWithStructuralIndex is enabled.  Parse states made from
+			/// iterators alone do not have it and scan the bytes
+			json_details::json_structural_index const *structural_index = nullptr;
 
 			template<auto... PolicyOptions>
 			using SetPolicyOptions = BasicParsePolicy<
@@ -13,7 +13,9 @@
 #include "daw_json_assert.h"
 #include "daw_json_parse_common.h"
 #include "daw_json_parse_policy_policy_details.h"
+#include "daw_json_skip_bracketed.h"
 #include "daw_json_string_util.h"
+#include "daw_json_structural_index.h"
 #include "daw_not_const_ex_functions.h"
 
 #include <daw/daw_attributes.h>
@@ -28,6 +30,31 @@
 namespace daw::json {
 	inline namespace DAW_JSON_VER {
 		struct NoCommentSkippingPolicy {
+			/// Pretty printed documents have long runs of indentation.  Once a run
+			/// is this long, the rest of it is skipped with the whitespace kernel
+			/// of the exec mode
+			static constexpr std::ptrdiff_t long_whitespace_run = 8;
+
+			/// @return true when the rest of the whitespace run was skipped
+			template<typename ParseState, typename CharT>
+			DAW_ATTRIB_INLINE static constexpr bool
+			skip_long_whitespace_run( CharT *const run_first, CharT *&first,
+			                          CharT *const last ) {
+				if constexpr( daw::traits::not_same<typename ParseState::exec_tag_t,
+				                                    constexpr_exec_tag>::value ) {
+					if( DAW_UNLIKELY( first - run_first == long_whitespace_run ) ) {
+						first = json_details::mem_skip_whitespace(
+						  typename ParseState::exec_tag_t{ }, first, last );
+						return true;
+					}
+				} else {
+					(void)run_first;
+					(void)first;
+					(void)last;
+				}
+				return false;
+			}
+
 			template<typename ParseState>
 			DAW_ATTRIB_FLATINLINE static constexpr void
 			trim_left_checked( ParseState &parse_state ) {
@@ -35,12 +62,11 @@ namespace daw::json {
 					return;
 				} else {
 					using CharT = typename ParseState::CharT;
-					// SIMD here was much slower, most JSON has very minimal whitespace
+					// SIMD on every call was much slower, most JSON has very minimal
+					// whitespace.  Only long runs are handed to it
 					CharT *first = parse_state.first;
 					CharT *const last = parse_state.last;
-
-					// only used when not zero terminated string and gcc9 warns
-					(void)last;
+					CharT *const run_first = first;
 
 					if constexpr( ParseState::is_zero_terminated_string ) {
 						// Ensure that zero terminator isn't included in skipable value
@@ -49,6 +75,10 @@ namespace daw::json {
 						    1U ) <= 0x1FU ) ) {
 
 							++first;
+							if( skip_long_whitespace_run<ParseState>( run_first, first,
+							                                          last ) ) {
+								break;
+							}
 						}
 					} else {
 						while(
@@ -56,6 +86,10 @@ namespace daw::json {
 						  ( static_cast<unsigned>( static_cast<unsigned char>( *first ) ) -
 						    1U ) <= 0x1FU ) {
 							++first;
+							if( skip_long_whitespace_run<ParseState>( run_first, first,
+							                                          last ) ) {
+								break;
+							}
 						}
 					}
 					parse_state.first = first;
@@ -70,11 +104,16 @@ namespace daw::json {
 				} else {
 					using CharT = typename ParseState::CharT;
 					CharT *first = parse_state.first;
+					CharT *const run_first = first;
 					while( DAW_UNLIKELY(
 					  ( static_cast<unsigned>( static_cast<unsigned char>( *first ) ) -
 					    1U ) <= 0x1F ) ) {
 
 						++first;
+						if( skip_long_whitespace_run<ParseState>( run_first, first,
+						                                          parse_state.last ) ) {
+							break;
+						}
 					}
 					parse_state.first = first;
 				}
@@ -138,6 +177,80 @@ namespace daw::json {
 				return ( c == '\0' ) | ( c == ',' ) | ( c == ']' ) | ( c == '}' );
 			}
 
+			/***
+			 * Skip a class or array by walking the structural index instead of the
+			 * document.  Strings are not in the index, so they cost nothing
+			 */
+			template<char PrimLeft, typename ParseState>
+			static ParseState
+			skip_bracketed_item_indexed( ParseState &parse_state ) {
+				constexpr char PrimRight = PrimLeft == '{' ? '}' : ']';
+				constexpr char SecLeft = PrimLeft == '{' ? '[' : '{';
+				constexpr char SecRight = SecLeft == '{' ? '}' : ']';
+
+				using CharT = typename ParseState::CharT;
+				auto const &index = *parse_state.structural_index;
+				CharT *ptr_first = parse_state.first;
+				CharT *const ptr_last = parse_state.last;
+				auto result = parse_state;
+				std::size_t cnt = 0;
+				std::uint32_t prime_bracket_count = 1;
+				std::uint32_t second_bracket_count = 0;
+
+				if( ptr_first < ptr_last and *ptr_first == PrimLeft ) {
+					++ptr_first;
+				}
+				std::uint32_t const *pos = index.find( ptr_first );
+				std::uint32_t const *const pos_last = index.end( );
+				for( ; pos != pos_last; ++pos ) {
+					CharT *const ptr = index.doc_first( ) + *pos;
+					if( ptr >= ptr_last ) {
+						break;
+					}
+					switch( *ptr ) {
+					case '"':
+						// Only the opening quote is indexed.  A string is closed before
+						// the next index entry, unless that entry is past the range
+						if( pos + 1 == pos_last or
+						    index.doc_first( ) + pos[1] >= ptr_last ) {
+							CharT *const str_last =
+							  json_details::mem_skip_until_end_of_string<false>(
+							    ParseState::exec_tag, ptr + 1, ptr_last );
+							daw_json_ensure( str_last < ptr_last and *str_last == '"',
+							                 ErrorReason::UnexpectedEndOfData, parse_state );
+						}
+						break;
+					case ',':
+						if( DAW_UNLIKELY( ( prime_bracket_count == 1 ) &
+						                  ( second_bracket_count == 0 ) ) ) {
+							++cnt;
+						}
+						break;
+					case PrimLeft:
+						++prime_bracket_count;
+						break;
+					case PrimRight:
+						--prime_bracket_count;
+						if( prime_bracket_count == 0 ) {
+							daw_json_ensure( second_bracket_count == 0,
+							                 ErrorReason::InvalidBracketing, parse_state );
+							result.last = ptr + 1;
+							result.counter = cnt;
+							parse_state.first = ptr + 1;
+							return result;
+						}
+						break;
+					case SecLeft:
+						++second_bracket_count;
+						break;
+					case SecRight:
+						--second_bracket_count;
+						break;
+					}
+				}
+				daw_json_error( ErrorReason::InvalidBracketing, parse_state );
+			}
+
 			template<char PrimLeft, typename ParseState>
 			DAW_ATTRIB_FLATTEN static constexpr ParseState
 			skip_bracketed_item_checked( ParseState &parse_state ) {
@@ -145,6 +258,12 @@ namespace daw::json {
 				constexpr char SecLeft = PrimLeft == '{' ? '[' : '{';
 				constexpr char SecRight = SecLeft == '{' ? '}' : ']';
 
+				if constexpr( ParseState::skip_with_structural_index ) {
+					if( parse_state.structural_index != nullptr and
+					    parse_state.structural_index->contains( parse_state.first ) ) {
+						return skip_bracketed_item_indexed<PrimLeft>( parse_state );
+					}
+				}
 				using CharT = typename ParseState::CharT;
 				// Not checking for Left as it is required to be skipped already
 				CharT *ptr_first = parse_state.first;
@@ -160,6 +279,22 @@ namespace daw::json {
 				if( *ptr_first == PrimLeft ) {
 					++ptr_first;
 				}
+				if constexpr( json_details::can_skip_bracketed_wide_v<
+				                typename ParseState::exec_tag_t> ) {
+					if( json_details::has_wide_kernels( ParseState::exec_tag ) ) {
+						auto const skipped = json_details::skip_bracketed_blocks<PrimLeft>(
+						  ParseState::exec_tag, ptr_first, ptr_last );
+						daw_json_ensure( not skipped.ends_in_string,
+						                 ErrorReason::UnexpectedEndOfData, parse_state );
+						daw_json_ensure( skipped.value_last != nullptr and
+						                   skipped.is_balanced,
+						                 ErrorReason::InvalidBracketing, parse_state );
+						result.last = skipped.value_last;
+						result.counter = skipped.commas;
+						parse_state.first = skipped.value_last;
+						return result;
+					}
+				}
 				while( DAW_LIKELY( ptr_first < ptr_last ) ) {
 					switch( *ptr_first ) {
 					case '\\':
@@ -221,6 +356,12 @@ namespace daw::json {
 				constexpr char PrimRight = PrimLeft == '{' ? '}' : ']';
 				constexpr char SecLeft = PrimLeft == '{' ? '[' : '{';
 				constexpr char SecRight = SecLeft == '{' ? '}' : ']';
+				if constexpr( ParseState::skip_with_structural_index ) {
+					if( parse_state.structural_index != nullptr and
+					    parse_state.structural_index->contains( parse_state.first ) ) {
+						return skip_bracketed_item_indexed<PrimLeft>( parse_state );
+					}
+				}
 				using CharT = typename ParseState::CharT;
 				auto result = parse_state;
 				std::size_t cnt = 0;
@@ -231,6 +372,22 @@ namespace daw::json {
 				if( *ptr_first == PrimLeft ) {
 					++ptr_first;
 				}
+				if constexpr( json_details::can_skip_bracketed_wide_v<
+				                typename ParseState::exec_tag_t> ) {
+					if( json_details::has_wide_kernels( ParseState::exec_tag ) ) {
+						auto const skipped = json_details::skip_bracketed_blocks<PrimLeft>(
+						  ParseState::exec_tag, ptr_first, parse_state.last );
+						CharT *const value_last = skipped.value_last != nullptr
+						                            ? skipped.value_last
+						                            : parse_state.last;
+						// We include the close primary bracket in the range so that
+						// subsequent parsers have a terminator inside their range
+						result.last = value_last;
+						result.counter = skipped.commas;
+						parse_state.first = value_last;
+						return result;
+					}
+				}
 				while( true ) {
 					switch( *ptr_first ) {
 					case '\\':
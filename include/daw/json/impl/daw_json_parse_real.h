@@ -13,6 +13,7 @@
 #include "daw_fp_fallback.h"
 #include "daw_json_assert.h"
 #include "daw_json_parse_policy_policy_details.h"
+#include "daw_json_parse_real_eisel_lemire.h"
 #include "daw_json_parse_real_power10.h"
 #include "daw_json_parse_unsigned_int.h"
 #include "daw_json_skip.h"
@@ -113,6 +114,15 @@ namespace daw::json {
 				}
 			}
 
+			/// @brief The number of significant digits kept before the rest are
+			/// dropped.  Precise parsing with eisel_lemire can use all the digits
+			/// that fit in a std::uint64_t
+			template<typename ParseState, typename Result>
+			inline constexpr auto max_significant_digits =
+			  ParseState::precise_ieee754 and is_eisel_lemire_real_v<Result>
+			    ? daw::numeric_limits<std::uint64_t>::digits10
+			    : daw::numeric_limits<Result>::max_digits10 + 1;
+
 			template<typename Result, typename ParseState>
 			[[nodiscard]] DAW_ATTRIB_INLINE static constexpr Result
 			parse_real_known( ParseState &parse_state ) {
@@ -158,7 +168,7 @@ namespace daw::json {
 					return static_cast<Result>( 1.0 );
 				}( );
 				using max_exponent = daw::constant<static_cast<std::ptrdiff_t>(
-				  daw::numeric_limits<Result>::max_digits10 + 1 )>;
+				  max_significant_digits<ParseState, Result> )>;
 				using unsigned_t =
 				  daw::conditional_t<max_storage_digits::value >= max_exponent::value,
 				                     std::uint64_t, Result>;
@@ -253,25 +263,25 @@ namespace daw::json {
 				}
 				if constexpr( std::is_floating_point_v<Result> and
 				              ParseState::precise_ieee754 ) {
-					// On std floating point types, check for conditions that cannot be
-					// precisely calculated using the normal method and use the fallback
+					// On std floating point types, use the exact methods when all the
+					// digits are in significant_digits.  Otherwise use the fallback
 					// method(usually strtod/from_chars)
-					use_strtod |= exponent > 22;
-					use_strtod |= exponent < -22;
-					use_strtod |= significant_digits > 9007199254740992ULL;
-					if constexpr( std::is_same_v<Result, long double> ) {
-						return json_details::parse_with_strtod<Result>( parse_state.first,
-						                                                parse_state.last );
-					} else {
-						if( DAW_UNLIKELY( use_strtod ) ) {
-							return json_details::parse_with_strtod<Result>(
-							  parse_state.first, parse_state.last );
+					if constexpr( is_eisel_lemire_real_v<Result> ) {
+						Result result;
+						if( DAW_LIKELY( not use_strtod and
+						                parse_real_precise<Result>(
+						                  significant_digits, exponent, sign < 0, false,
+						                  result ) ) ) {
+							return result;
 						}
 					}
+					return json_details::parse_with_strtod<Result>( parse_state.first,
+					                                                parse_state.last );
+				} else {
+					return sign * power10<Result>(
+					                ParseState::exec_tag,
+					                static_cast<Result>( significant_digits ), exponent );
 				}
-				return sign * power10<Result>(
-				                ParseState::exec_tag,
-				                static_cast<Result>( significant_digits ), exponent );
 			}
 
 			template<typename Result, typename ParseState>
@@ -298,7 +308,7 @@ namespace daw::json {
 				using max_storage_digits = daw::constant<static_cast<std::int64_t>(
 				  daw::numeric_limits<std::uint64_t>::digits10 )>;
 				using max_exponent = daw::constant<static_cast<std::int64_t>(
-				  daw::numeric_limits<Result>::max_digits10 + 1 )>;
+				  max_significant_digits<ParseState, Result> )>;
 				using unsigned_t =
 				  daw::conditional_t<max_storage_digits::value >= max_exponent::value,
 				                     std::uint64_t, Result>;
@@ -458,7 +468,20 @@ namespace daw::json {
 				parse_state.first = first;
 
 				if constexpr( std::is_floating_point_v<Result> and
-				              ParseState::precise_ieee754 ) {
+				              ParseState::precise_ieee754 and
+				              is_eisel_lemire_real_v<Result> ) {
+					// use_strtod is set when digits past significant_digits were
+					// skipped, the value is then bounded by significant_digits + 1
+					Result result;
+					if( DAW_LIKELY( sig_digit_count <= max_storage_digits::value and
+					                parse_real_precise<Result>(
+					                  static_cast<std::uint64_t>( significant_digits ),
+					                  exponent, sign < 0, use_strtod, result ) ) ) {
+						return result;
+					}
+					return parse_with_strtod<Result>( orig_first, orig_last );
+				} else if constexpr( std::is_floating_point_v<Result> and
+				                     ParseState::precise_ieee754 ) {
 					use_strtod |= DAW_UNLIKELY( exponent > 22 );
 					use_strtod |= DAW_UNLIKELY( exponent < -22 );
 					use_strtod |=
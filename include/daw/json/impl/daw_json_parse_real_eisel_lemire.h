@@ -0,0 +1,261 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#pragma once
+
+#include "version.h"
+
+#include "daw_json_parse_real_power10.h"
+#include "power_of_five_128_table.h"
+
+#include <daw/daw_attributes.h>
+#include <daw/daw_cpp_feature_check.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#if defined( _MSC_VER ) and defined( _M_X64 ) and not defined( __clang__ )
+#include <intrin.h>
+#endif
+
+namespace daw::json {
+	inline namespace DAW_JSON_VER {
+		namespace json_details {
+			/// @brief The IEEE754 layout of the floating point types that
+			/// eisel_lemire can produce
+			template<typename Real>
+			struct eisel_lemire_format;
+
+			template<>
+			struct eisel_lemire_format<double> {
+				using bits_t = std::uint64_t;
+				static constexpr int mantissa_explicit_bits = 52;
+				static constexpr int minimum_exponent = -1023;
+				static constexpr int infinite_power = 0x7FF;
+				static constexpr int smallest_power_of_ten = -342;
+				static constexpr int largest_power_of_ten = 308;
+				static constexpr int min_exponent_round_to_even = -4;
+				static constexpr int max_exponent_round_to_even = 23;
+				// Both the mantissa and the power of ten are exact doubles, so a
+				// single multiplication or division is correctly rounded
+				static constexpr std::int64_t max_exact_power10 = 22;
+				static constexpr std::uint64_t max_exact_mantissa = 1ULL << 53U;
+			};
+
+			template<>
+			struct eisel_lemire_format<float> {
+				using bits_t = std::uint32_t;
+				static constexpr int mantissa_explicit_bits = 23;
+				static constexpr int minimum_exponent = -127;
+				static constexpr int infinite_power = 0xFF;
+				static constexpr int smallest_power_of_ten = -65;
+				static constexpr int largest_power_of_ten = 38;
+				static constexpr int min_exponent_round_to_even = -17;
+				static constexpr int max_exponent_round_to_even = 10;
+				static constexpr std::int64_t max_exact_power10 = 10;
+				static constexpr std::uint64_t max_exact_mantissa = 1ULL << 24U;
+			};
+
+			template<typename Real>
+			inline constexpr bool is_eisel_lemire_real_v =
+			  std::is_same_v<Real, double> or std::is_same_v<Real, float>;
+
+			/// The power of ten of the first entry in pow5_tbl
+			inline constexpr std::int64_t smallest_power_of_five = -342;
+
+			struct uint128_parts {
+				std::uint64_t low;
+				std::uint64_t high;
+			};
+
+			DAW_ATTRIB_INLINE uint128_parts full_multiplication( std::uint64_t a,
+			                                                     std::uint64_t b ) {
+#if defined( __SIZEOF_INT128__ )
+				__extension__ using uint128_t = unsigned __int128;
+				auto const r = static_cast<uint128_t>( a ) * b;
+				return { static_cast<std::uint64_t>( r ),
+				         static_cast<std::uint64_t>( r >> 64U ) };
+#elif defined( _MSC_VER ) and defined( _M_X64 ) and not defined( __clang__ )
+				uint128_parts result;
+				result.low = _umul128( a, b, &result.high );
+				return result;
+#else
+				std::uint64_t const a_lo = a & 0xFFFF'FFFFU;
+				std::uint64_t const a_hi = a >> 32U;
+				std::uint64_t const b_lo = b & 0xFFFF'FFFFU;
+				std::uint64_t const b_hi = b >> 32U;
+				std::uint64_t const lo_lo = a_lo * b_lo;
+				std::uint64_t const hi_lo = a_hi * b_lo;
+				std::uint64_t const lo_hi = a_lo * b_hi;
+				std::uint64_t const hi_hi = a_hi * b_hi;
+				std::uint64_t const cross =
+				  ( lo_lo >> 32U ) + ( hi_lo & 0xFFFF'FFFFU ) + lo_hi;
+				return { ( cross << 32U ) | ( lo_lo & 0xFFFF'FFFFU ),
+				         ( hi_lo >> 32U ) + ( cross >> 32U ) + hi_hi };
+#endif
+			}
+
+			/// value must not be 0
+			DAW_ATTRIB_INLINE int clz64( std::uint64_t value ) {
+#if DAW_HAS_BUILTIN( __builtin_clzll )
+				return __builtin_clzll( value );
+#elif defined( _MSC_VER ) and defined( _M_X64 )
+				unsigned long index;
+				_BitScanReverse64( &index, value );
+				return 63 - static_cast<int>( index );
+#else
+				int result = 0;
+				while( ( value & 0x8000'0000'0000'0000ULL ) == 0 ) {
+					value <<= 1U;
+					++result;
+				}
+				return result;
+#endif
+			}
+
+			/***
+			 * @brief Compute the floating point value nearest to w * 10^q with the
+			 * Eisel-Lemire algorithm, see "Number Parsing at a Gigabyte per Second"
+			 * by Daniel Lemire.
+			 * @param w All the significant digits of the number
+			 * @param q The power of ten applied to w
+			 * @param is_negative Set the sign bit of the result
+			 * @param result The correctly rounded value when true is returned
+			 * @return false when the product is too close to halfway between two
+			 * values to decide.  The caller must fall back to an exact method
+			 */
+			template<typename Real>
+			[[nodiscard]] inline bool eisel_lemire( std::uint64_t w, std::int64_t q,
+			                                        bool is_negative,
+			                                        Real &result ) {
+				using format = eisel_lemire_format<Real>;
+				using bits_t = typename format::bits_t;
+				constexpr int mantissa_bits = format::mantissa_explicit_bits;
+				// Keep 3 bits past the mantissa for the hidden bit and rounding
+				constexpr int shift = 64 - mantissa_bits - 3;
+
+				std::uint64_t mantissa = 0;
+				std::int64_t power2 = 0;
+				if( w == 0 or q < format::smallest_power_of_ten ) {
+					// Zero or underflow, both are 0 with the sign kept
+				} else if( q > format::largest_power_of_ten ) {
+					power2 = format::infinite_power;
+				} else {
+					int const lz = clz64( w );
+					w <<= static_cast<unsigned>( lz );
+					auto const index =
+					  2U * static_cast<std::size_t>( q - smallest_power_of_five );
+					uint128_parts product = full_multiplication( w, pow5_tbl[index] );
+					constexpr std::uint64_t precision_mask =
+					  0xFFFF'FFFF'FFFF'FFFFULL >>
+					  static_cast<unsigned>( mantissa_bits + 3 );
+					if( ( product.high & precision_mask ) == precision_mask ) {
+						// The truncated power of five may not be enough, add the next 64
+						// bits of it
+						uint128_parts const second =
+						  full_multiplication( w, pow5_tbl[index + 1U] );
+						product.low += second.high;
+						if( second.high > product.low ) {
+							++product.high;
+						}
+					}
+					if( product.low == 0xFFFF'FFFF'FFFF'FFFFULL and
+					    ( q < -27 or q > 55 ) ) {
+						// The lower bits may still carry into the result
+						return false;
+					}
+					auto const upper_bit = static_cast<int>( product.high >> 63U );
+					mantissa = product.high >> static_cast<unsigned>( upper_bit + shift );
+					power2 = ( ( ( 152170 + 65536 ) * q ) >> 16 ) + 63 + upper_bit - lz -
+					         format::minimum_exponent;
+					if( power2 <= 0 ) {
+						// Subnormal
+						if( -power2 + 1 >= 64 ) {
+							mantissa = 0;
+							power2 = 0;
+						} else {
+							mantissa >>= static_cast<unsigned>( -power2 + 1 );
+							mantissa += mantissa & 1U;
+							mantissa >>= 1U;
+							power2 = mantissa < ( 1ULL << mantissa_bits ) ? 0 : 1;
+						}
+					} else {
+						// Exactly halfway, round to even instead of up
+						if( product.low <= 1 and q >= format::min_exponent_round_to_even and
+						    q <= format::max_exponent_round_to_even and
+						    ( mantissa & 3U ) == 1U and
+						    ( mantissa << static_cast<unsigned>( upper_bit + shift ) ) ==
+						      product.high ) {
+							mantissa &= ~std::uint64_t{ 1 };
+						}
+						mantissa += mantissa & 1U;
+						mantissa >>= 1U;
+						if( mantissa >= ( 2ULL << mantissa_bits ) ) {
+							mantissa = 1ULL << mantissa_bits;
+							++power2;
+						}
+						mantissa &= ~( 1ULL << mantissa_bits );
+						if( power2 >= format::infinite_power ) {
+							mantissa = 0;
+							power2 = format::infinite_power;
+						}
+					}
+				}
+				auto const bits = static_cast<bits_t>(
+				  mantissa | ( static_cast<std::uint64_t>( power2 ) << mantissa_bits ) |
+				  ( static_cast<std::uint64_t>( is_negative )
+				    << ( sizeof( bits_t ) * 8U - 1U ) ) );
+				static_assert( sizeof( bits_t ) == sizeof( Real ) );
+				std::memcpy( &result, &bits, sizeof( Real ) );
+				return true;
+			}
+
+			/***
+			 * @brief Try the fast ways to compute the nearest value to w * 10^q.
+			 * When digits past w were dropped the value is somewhere in
+			 * [w, w + 1) * 10^q and the result is only known when both ends round
+			 * to the same value
+			 * @return false when the caller must fall back to an exact method
+			 */
+			template<typename Real>
+			[[nodiscard]] inline bool parse_real_precise( std::uint64_t w,
+			                                              std::int64_t q,
+			                                              bool is_negative,
+			                                              bool truncated,
+			                                              Real &result ) {
+				using format = eisel_lemire_format<Real>;
+				if( not truncated and w <= format::max_exact_mantissa and
+				    q >= -format::max_exact_power10 and
+				    q <= format::max_exact_power10 ) {
+					// Clinger's fast path
+					auto const value = static_cast<Real>( w );
+					result =
+					  q < 0 ? value / static_cast<Real>(
+					                    dpow10_tbl[static_cast<std::size_t>( -q )] )
+					        : value * static_cast<Real>(
+					                    dpow10_tbl[static_cast<std::size_t>( q )] );
+					if( is_negative ) {
+						result = -result;
+					}
+					return true;
+				}
+				if( not eisel_lemire( w, q, is_negative, result ) ) {
+					return false;
+				}
+				if( truncated ) {
+					Real upper;
+					return eisel_lemire( w + 1U, q, is_negative, upper ) and
+					       upper == result;
+				}
+				return true;
+			}
+		} // namespace json_details
+	} // namespace DAW_JSON_VER
+} // namespace daw::json
@@ -21,6 +21,8 @@
 #include <daw/daw_likely.h>
 
 #include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <daw/stdinc/data_access.h>
 #include <daw/stdinc/range_access.h>
 #include <type_traits>
@@ -195,18 +197,138 @@ namespace daw::json {
 				inline constexpr char const escape_quotes[] = "\\\"";
 			}
 
-			// Fast path for parsing escaped strings to a std::string with the default
-			// appender
-			template<bool AllowHighEight, typename JsonMember, bool KnownBounds,
-			         typename ParseState>
-			[[nodiscard]] static constexpr auto // json_result_t<JsonMember>
-			parse_string_known_stdstring( ParseState &parse_state ) {
-				using string_type = json_base_type_t<JsonMember>;
-				string_type result =
-				  string_type( std::size( parse_state ) + 1, '\0',
-				               parse_state.template get_allocator_for<char>( ) );
-				char *it = std::data( result );
+			/***
+			 * Decode the escape that starts at the backslash in front of
+			 * parse_state
+			 * @return One past the decoded characters
+			 */
+			template<bool AllowHighEight, typename ParseState>
+			[[nodiscard]] static constexpr char *
+			decode_escape( ParseState &parse_state, char *it ) {
+				parse_state.remove_prefix( );
+				daw_json_assert_weak( not parse_state.is_space_unchecked( ),
+				                      ErrorReason::InvalidUTFCodepoint, parse_state );
+				switch( parse_state.front( ) ) {
+				case 'b':
+					*it++ = '\b';
+					parse_state.remove_prefix( );
+					break;
+				case 'f':
+					*it++ = '\f';
+					parse_state.remove_prefix( );
+					break;
+				case 'n':
+					*it++ = '\n';
+					parse_state.remove_prefix( );
+					break;
+				case 'r':
+					*it++ = '\r';
+					parse_state.remove_prefix( );
+					break;
+				case 't':
+					*it++ = '\t';
+					parse_state.remove_prefix( );
+					break;
+				case 'u':
+					it = decode_utf16( parse_state, it );
+					break;
+				case '/':
+				case '\\':
+				case '"':
+					*it++ = parse_state.front( );
+					parse_state.remove_prefix( );
+					break;
+				default:
+					if constexpr( not AllowHighEight ) {
+						daw_json_assert_weak(
+						  ( not parse_state.is_space_unchecked( ) ) &
+						    ( static_cast<unsigned char>( parse_state.front( ) ) <= 0x7FU ),
+						  ErrorReason::InvalidStringHighASCII, parse_state );
+					}
+					*it++ = parse_state.front( );
+					parse_state.remove_prefix( );
+				}
+				return it;
+			}
+
+#if defined( DAW_JSON_HAS_RUNTIME_CPU_DISPATCH )
+			/***
+			 * Decode the escaped string in parse_state 64 bytes at a time.  Blocks
+			 * without a quote or backslash are copied with one store, the others
+			 * copy the runs between the escapes and decode the escapes in place.
+			 * Stops at the closing quote or when less than 64 bytes are left in the
+			 * input or the output
+			 * @return One past the last decoded character
+			 */
+			template<bool AllowHighEight, typename ExecTag, typename ParseState,
+			         std::enable_if_t<is_wide_exec_tag_v<ExecTag>, std::nullptr_t> =
+			           nullptr>
+			[[nodiscard]] inline char *
+			decode_escaped_blocks( ExecTag tag, ParseState &parse_state, char *it,
+			                       char const *const out_last ) {
+				while( ( parse_state.last - parse_state.first >= 64 ) &
+				       ( out_last - it >= 64 ) ) {
+					char const *const block = parse_state.first;
+					auto const masks = find_quotes_and_backslashes64( tag, block );
+					std::uint64_t stops = masks.quotes | masks.backslashes;
+					while( stops != 0 ) {
+						auto const idx = ctz64( stops );
+						auto const run = static_cast<std::size_t>(
+						  ( block + idx ) - parse_state.first );
+						std::memcpy( it, parse_state.first, run );
+						it += run;
+						parse_state.first = block + idx;
+						if( ( masks.quotes >> idx ) & 1U ) {
+							return it;
+						}
+						it = decode_escape<AllowHighEight>( parse_state, it );
+						auto const consumed = parse_state.first - block;
+						if( consumed >= 64 ) {
+							break;
+						}
+						// Drop the stops that were part of the escape
+						stops &= ~std::uint64_t{ 0 } << static_cast<unsigned>( consumed );
+					}
+					auto const block_last = block + 64;
+					if( parse_state.first < block_last ) {
+						auto const run =
+						  static_cast<std::size_t>( block_last - parse_state.first );
+						std::memcpy( it, parse_state.first, run );
+						it += run;
+						parse_state.first = block_last;
+					}
+				}
+				return it;
+			}
 
+			template<bool AllowHighEight, typename ParseState>
+			[[nodiscard]] inline char *
+			decode_escaped_blocks( best_available_exec_tag, ParseState &parse_state,
+			                       char *it, char const *const out_last ) {
+				switch( best_simd_level( ) ) {
+				case simd_level::avx512:
+					return decode_escaped_blocks<AllowHighEight>(
+					  avx512_exec_tag{ }, parse_state, it, out_last );
+				case simd_level::avx2:
+					return decode_escaped_blocks<AllowHighEight>(
+					  avx2_exec_tag{ }, parse_state, it, out_last );
+				case simd_level::none:
+					break;
+				}
+				return it;
+			}
+#endif
+
+			/***
+			 * Decode the escaped string in parse_state to the buffer at it
+			 * @pre The buffer ending at out_last can hold std::size( parse_state )
+			 * characters
+			 * @return One past the last decoded character
+			 */
+			template<bool AllowHighEight, bool KnownBounds, typename ParseState>
+			[[nodiscard]] static constexpr char *
+			decode_escaped_string( ParseState &parse_state, char *it,
+			                       char const *const out_last ) {
 				bool const has_quote = parse_state.front( ) == '"';
 				if( has_quote ) {
 					parse_state.remove_prefix( );
@@ -229,6 +351,14 @@ namespace daw::json {
 					  }
 				  };
 
+#if defined( DAW_JSON_HAS_RUNTIME_CPU_DISPATCH )
+				using exec_tag_t = typename ParseState::exec_tag_t;
+				if constexpr( is_wide_exec_tag_v<exec_tag_t> or
+				              std::is_same_v<exec_tag_t, best_available_exec_tag> ) {
+					it = decode_escaped_blocks<AllowHighEight>(
+					  ParseState::exec_tag, parse_state, it, out_last );
+				}
+#endif
 				while( pred( parse_state ) ) {
 					{
 						char const *first = parse_state.first;
@@ -252,60 +382,14 @@ namespace daw::json {
 							                      '"', '\\'>( ParseState::exec_tag, first,
 							                                  last );
 						}
-						daw_json_assert_weak(
-						  static_cast<std::ptrdiff_t>( result.size( ) ) -
-						      std::distance( result.data( ), it ) >=
-						    std::distance( parse_state.first, first ),
-						  ErrorReason::UnexpectedEndOfData );
+						daw_json_assert_weak( std::distance( it, out_last ) >=
+						                        std::distance( parse_state.first, first ),
+						                      ErrorReason::UnexpectedEndOfData );
 						it = daw::algorithm::copy( parse_state.first, first, it );
 						parse_state.first = first;
 					}
 					if( parse_state.front( ) == '\\' ) {
-						parse_state.remove_prefix( );
-						daw_json_assert_weak( not parse_state.is_space_unchecked( ),
-						                      ErrorReason::InvalidUTFCodepoint,
-						                      parse_state );
-						switch( parse_state.front( ) ) {
-						case 'b':
-							*it++ = '\b';
-							parse_state.remove_prefix( );
-							break;
-						case 'f':
-							*it++ = '\f';
-							parse_state.remove_prefix( );
-							break;
-						case 'n':
-							*it++ = '\n';
-							parse_state.remove_prefix( );
-							break;
-						case 'r':
-							*it++ = '\r';
-							parse_state.remove_prefix( );
-							break;
-						case 't':
-							*it++ = '\t';
-							parse_state.remove_prefix( );
-							break;
-						case 'u':
-							it = decode_utf16( parse_state, it );
-							break;
-						case '/':
-						case '\\':
-						case '"':
-							*it++ = parse_state.front( );
-							parse_state.remove_prefix( );
-							break;
-						default:
-							if constexpr( not AllowHighEight ) {
-								daw_json_assert_weak(
-								  ( not parse_state.is_space_unchecked( ) ) &
-								    ( static_cast<unsigned char>( parse_state.front( ) ) <=
-								      0x7FU ),
-								  ErrorReason::InvalidStringHighASCII, parse_state );
-							}
-							*it++ = parse_state.front( );
-							parse_state.remove_prefix( );
-						}
+						it = decode_escape<AllowHighEight>( parse_state, it );
 					} else {
 						daw_json_assert_weak( not has_quote or
 						                        parse_state.is_quotes_checked( ),
@@ -314,6 +398,23 @@ namespace daw::json {
 					daw_json_assert_weak( not has_quote or parse_state.has_more( ),
 					                      ErrorReason::UnexpectedEndOfData, parse_state );
 				}
+				return it;
+			}
+
+			// Fast path for parsing escaped strings to a std::string with the default
+			// appender
+			template<bool AllowHighEight, typename JsonMember, bool KnownBounds,
+			         typename ParseState>
+			[[nodiscard]] static constexpr auto // json_result_t<JsonMember>
+			parse_string_known_stdstring( ParseState &parse_state ) {
+				using string_type = json_base_type_t<JsonMember>;
+				string_type result =
+				  string_type( std::size( parse_state ) + 1, '\0',
+				               parse_state.template get_allocator_for<char>( ) );
+				char *it = std::data( result );
+
+				it = decode_escaped_string<AllowHighEight, KnownBounds>(
+				  parse_state, it, daw::data_end( result ) );
 				auto const sz =
 				  static_cast<std::size_t>( std::distance( std::data( result ), it ) );
 				daw_json_assert_weak( std::size( result ) >= sz,
@@ -328,6 +429,94 @@ namespace daw::json {
 					  parse_state, std::data( result ), daw::data_end( result ) );
 				}
 			}
+
+			/***
+			 * Decode the escapes of a string over the start of the string.  The
+			 * decoded string is never longer than the escaped one, and each escape
+			 * is read before its decoded characters are written.  See
+			 * options::UnescapeInPlace
+			 * @pre parse_state is the string without the quotes and its buffer is
+			 * mutable
+			 * @return One past the last decoded character
+			 */
+			template<bool AllowHighEight, typename ParseState>
+			[[nodiscard]] static char *
+			unescape_string_in_place( ParseState parse_state ) {
+				static_assert( ParseState::unescape_in_place );
+				// The document is mutable.  The entry points that accept
+				// options::UnescapeInPlace check it with is_mutable_string_v
+				char *it = const_cast<char *>( parse_state.first );
+				char const *const last = parse_state.last;
+				if( auto const first_slash =
+				      static_cast<std::ptrdiff_t>( parse_state.counter ) - 1;
+				    first_slash > 0 ) {
+					// Everything before the first escape is already in place
+					it += first_slash;
+					parse_state.first += first_slash;
+				}
+				while( parse_state.first < last ) {
+					auto const *slash = static_cast<char const *>( std::memchr(
+					  parse_state.first, '\\',
+					  static_cast<std::size_t>( last - parse_state.first ) ) );
+					if( slash == nullptr ) {
+						slash = last;
+					}
+					auto const run = static_cast<std::size_t>( slash - parse_state.first );
+					if( it != parse_state.first ) {
+						std::memmove( it, parse_state.first, run );
+					}
+					it += run;
+					parse_state.first = slash;
+					if( slash == last ) {
+						break;
+					}
+					parse_state.remove_prefix( );
+					daw_json_assert_weak( parse_state.has_more( ) and
+					                        not parse_state.is_space_unchecked( ),
+					                      ErrorReason::InvalidUTFCodepoint,
+					                      parse_state );
+					switch( parse_state.front( ) ) {
+					case 'b':
+						*it++ = '\b';
+						parse_state.remove_prefix( );
+						break;
+					case 'f':
+						*it++ = '\f';
+						parse_state.remove_prefix( );
+						break;
+					case 'n':
+						*it++ = '\n';
+						parse_state.remove_prefix( );
+						break;
+					case 'r':
+						*it++ = '\r';
+						parse_state.remove_prefix( );
+						break;
+					case 't':
+						*it++ = '\t';
+						parse_state.remove_prefix( );
+						break;
+					case 'u':
+						it = decode_utf16( parse_state, it );
+						break;
+					case '/':
+					case '\\':
+					case '"':
+						*it++ = parse_state.front( );
+						parse_state.remove_prefix( );
+						break;
+					default:
+						if constexpr( not AllowHighEight ) {
+							daw_json_assert_weak(
+							  static_cast<unsigned char>( parse_state.front( ) ) <= 0x7FU,
+							  ErrorReason::InvalidStringHighASCII, parse_state );
+						}
+						*it++ = parse_state.front( );
+						parse_state.remove_prefix( );
+					}
+				}
+				return it;
+			}
 		} // namespace json_details
 	} // namespace DAW_JSON_VER
 } // namespace daw::json
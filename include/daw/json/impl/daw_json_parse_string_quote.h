@@ -11,12 +11,14 @@
 #include "version.h"
 
 #include "daw_json_assert.h"
+#include "daw_json_escape_scan.h"
 #include "daw_not_const_ex_functions.h"
 
 #include <daw/daw_traits.h>
 #include <daw/daw_uint_buffer.h>
 
 #include <cstddef>
+#include <cstdint>
 #include <type_traits>
 
 namespace daw::json {
@@ -89,6 +91,221 @@ namespace daw::json {
 				first -= *( first - 1 ) == '\\' ? 1 : 0;
 			}
 
+			template<typename ParseState, typename CharT>
+			[[noreturn]] DAW_ATTRIB_NOINLINE void
+			invalid_string_at( ParseState &parse_state, CharT *pos ) {
+				// Report the offending character instead of the start of the string
+				parse_state.first = pos;
+				daw_json_error( ErrorReason::InvalidString, parse_state );
+			}
+
+			/***
+			 * The string, or the escape or UTF-8 sequence at pos, runs into last.
+			 * In a zero terminated buffer the byte at last is the terminating NUL,
+			 * so the data ended before the string did
+			 */
+			template<typename ParseState, typename CharT>
+			[[noreturn]] DAW_ATTRIB_NOINLINE void
+			string_cut_at( ParseState &parse_state, CharT *pos ) {
+				if constexpr( ParseState::is_zero_terminated_string ) {
+					parse_state.first = pos;
+					daw_json_error( ErrorReason::UnexpectedEndOfData, parse_state );
+				} else {
+					invalid_string_at( parse_state, pos );
+				}
+			}
+
+			/***
+			 * Skip the UTF-8 sequence at first.  The range of the second byte
+			 * depends on the lead byte so that overlong forms, surrogates and code
+			 * points above 0x10FFFF are rejected.
+			 * @return One past the sequence
+			 */
+			template<typename ParseState, typename CharT>
+			DAW_ATTRIB_INLINE constexpr CharT *
+			skip_utf8_sequence( ParseState &parse_state, CharT *first,
+			                    CharT *const last ) {
+				auto const lead = static_cast<unsigned char>( *first );
+				if( lead < 0x80U ) {
+					return first + 1;
+				}
+				std::ptrdiff_t length = 0;
+				unsigned char second_min = 0x80U;
+				unsigned char second_max = 0xBFU;
+				if( lead >= 0xC2U and lead <= 0xDFU ) {
+					length = 2;
+				} else if( lead >= 0xE0U and lead <= 0xEFU ) {
+					length = 3;
+					if( lead == 0xE0U ) {
+						second_min = 0xA0U;
+					} else if( lead == 0xEDU ) {
+						second_max = 0x9FU;
+					}
+				} else if( lead >= 0xF0U and lead <= 0xF4U ) {
+					length = 4;
+					if( lead == 0xF0U ) {
+						second_min = 0x90U;
+					} else if( lead == 0xF4U ) {
+						second_max = 0x8FU;
+					}
+				}
+				if( length == 0 ) {
+					invalid_string_at( parse_state, first );
+				}
+				if( last - first < length ) {
+					string_cut_at( parse_state, first );
+				}
+				auto const second = static_cast<unsigned char>( first[1] );
+				if( second < second_min or second > second_max ) {
+					invalid_string_at( parse_state, first + 1 );
+				}
+				for( std::ptrdiff_t n = 2; n < length; ++n ) {
+					if( ( static_cast<unsigned char>( first[n] ) & 0xC0U ) != 0x80U ) {
+						invalid_string_at( parse_state, first + n );
+					}
+				}
+				return first + length;
+			}
+
+			/***
+			 * Skip the run of multi-byte UTF-8 at first, one sequence at a time,
+			 * up to the next ASCII character.  Multi-byte text tends to come in
+			 * runs
+			 * @return One past the run
+			 */
+			template<typename ParseState, typename CharT>
+			DAW_ATTRIB_INLINE constexpr CharT *
+			skip_utf8_run( constexpr_exec_tag, ParseState &parse_state,
+			               CharT *first, CharT *const last ) {
+				do {
+					first = skip_utf8_sequence( parse_state, first, last );
+				} while( first < last and
+				         static_cast<unsigned char>( *first ) >= 0x80U );
+				return first;
+			}
+
+#if defined( DAW_JSON_HAS_RUNTIME_CPU_DISPATCH )
+			/***
+			 * Validate the string at first 64 bytes at a time with
+			 * find_utf8_errors64, ASCII included, until the block that holds its
+			 * next quote, backslash or control character.  The bytes after that
+			 * character are not checked here.  A block with an error in the string
+			 * is left to the byte loop, which reports the same byte as the other
+			 * exec modes
+			 * @return The position of the quote, backslash or control character
+			 * or where the byte loop stopped
+			 */
+			template<typename ExecTag, typename ParseState, typename CharT,
+			         std::enable_if_t<is_wide_exec_tag_v<ExecTag>, std::nullptr_t> =
+			           nullptr>
+			CharT *skip_utf8_run( ExecTag tag, ParseState &parse_state,
+			                      CharT *first, CharT *const last ) {
+				while( last - first >= 64 ) {
+					std::uint64_t const stops = find_escape64<false>( tag, first );
+					std::uint64_t const errors = find_utf8_errors64( tag, first );
+					if( stops != 0 ) {
+						// The stop character itself is flagged when it cuts a sequence
+						// short
+						std::uint64_t const in_string = ( 2ULL << ctz64( stops ) ) - 1U;
+						if( ( errors & in_string ) != 0 ) {
+							break;
+						}
+						return first + ctz64( stops );
+					}
+					if( errors != 0 ) {
+						break;
+					}
+					first += 64 - utf8_cut_tail64( first );
+				}
+				// find_escape also stops at DEL, which the byte loop steps over
+				if( first < last and static_cast<unsigned char>( *first ) >= 0x7FU ) {
+					return skip_utf8_run( constexpr_exec_tag{ }, parse_state, first,
+					                      last );
+				}
+				return first;
+			}
+
+			template<typename ParseState, typename CharT>
+			CharT *skip_utf8_run( best_available_exec_tag, ParseState &parse_state,
+			                      CharT *first, CharT *const last ) {
+				switch( best_simd_level( ) ) {
+				case simd_level::avx512:
+					return skip_utf8_run( avx512_exec_tag{ }, parse_state, first, last );
+				case simd_level::avx2:
+					return skip_utf8_run( avx2_exec_tag{ }, parse_state, first, last );
+				case simd_level::none:
+					break;
+				}
+				return skip_utf8_run( constexpr_exec_tag{ }, parse_state, first,
+				                      last );
+			}
+#endif
+
+			/***
+			 * Find the closing quote of the string and validate it along the way.
+			 * With check_escapes, characters below 0x20 and the escapes that
+			 * ExcludeSpecialEscapes disallows are rejected.  With check_utf8 the
+			 * multi-byte sequences must be valid UTF-8.  The runs that need neither
+			 * are skipped with find_escape, only the characters it stops at are
+			 * looked at individually.
+			 * @return The position of the closing quote or last
+			 */
+			template<bool check_escapes, bool check_utf8, typename ParseState,
+			         typename CharT>
+			DAW_ATTRIB_INLINE constexpr CharT *
+			skip_validated_string( ParseState &parse_state, CharT *first,
+			                       CharT *const last, std::ptrdiff_t &first_escape ) {
+				while( true ) {
+					char const *const stop =
+					  find_escape<check_utf8>( ParseState::exec_tag, first, last );
+					first += stop - first;
+					if( first >= last ) {
+						if constexpr( ParseState::is_zero_terminated_string ) {
+							string_cut_at( parse_state, last );
+						}
+						return first;
+					}
+					if( *first == '"' ) {
+						return first;
+					}
+					auto const c = static_cast<unsigned char>( *first );
+					if( c == '\\' ) {
+						if constexpr( check_escapes ) {
+							if( last - first < 2 ) {
+								string_cut_at( parse_state, first );
+							}
+							switch( first[1] ) {
+							case '"':
+							case '\\':
+							case '/':
+							case 'b':
+							case 'f':
+							case 'n':
+							case 'r':
+							case 't':
+							case 'u':
+								break;
+							default:
+								invalid_string_at( parse_state, first + 1 );
+							}
+						}
+						if( first_escape < 0 ) {
+							first_escape = first - parse_state.first;
+						}
+						first += 2;
+					} else if( c < 0x20U ) {
+						if constexpr( check_escapes ) {
+							invalid_string_at( parse_state, first );
+						}
+						++first;
+					} else {
+						// Only flagged when checking UTF-8
+						first =
+						  skip_utf8_run( ParseState::exec_tag, parse_state, first, last );
+					}
+				}
+			}
+
 			namespace string_quote_parser {
 				template<typename ParseState>
 				[[nodiscard]] static constexpr std::size_t
@@ -100,8 +317,12 @@ namespace daw::json {
 					// This is a logic error to happen.
 					// daw_json_assert_weak( first != '"', "Unexpected quote", parse_state
 					// );
-					if constexpr( daw::traits::not_same_v<typename ParseState::exec_tag_t,
-					                                 constexpr_exec_tag> ) {
+					if constexpr( ParseState::validate_utf8 ) {
+						first = skip_validated_string<false, true>( parse_state, first,
+						                                            last, need_slow_path );
+					} else if constexpr( daw::traits::not_same_v<
+					                       typename ParseState::exec_tag_t,
+					                       constexpr_exec_tag> ) {
 						first = mem_skip_until_end_of_string<true>(
 						  ParseState::exec_tag, first, last, need_slow_path );
 					} else {
@@ -142,116 +363,52 @@ namespace daw::json {
 					std::ptrdiff_t need_slow_path = -1;
 					CharT *first = parse_state.first;
 					CharT *const last = parse_state.class_last;
-					if constexpr( daw::traits::not_same_v<typename ParseState::exec_tag_t,
-					                                 constexpr_exec_tag> ) {
+					if constexpr( ParseState::exclude_special_escapes or
+					              ParseState::validate_utf8 ) {
+						first = skip_validated_string<ParseState::exclude_special_escapes,
+						                              ParseState::validate_utf8>(
+						  parse_state, first, last, need_slow_path );
+					} else if constexpr( daw::traits::not_same_v<
+					                       typename ParseState::exec_tag_t,
+					                       constexpr_exec_tag> ) {
 						first = mem_skip_until_end_of_string<false>(
 						  ParseState::exec_tag, first, last, need_slow_path );
 					} else {
-						if constexpr( not ParseState::exclude_special_escapes ) {
-							if( CharT *const l = parse_state.last; l - first >= 8 ) {
-								skip_to_first8( first, l );
-							} else if( last - first >= 4 ) {
-								skip_to_first4( first, l );
-							}
+						if( CharT *const l = parse_state.last; l - first >= 8 ) {
+							skip_to_first8( first, l );
+						} else if( last - first >= 4 ) {
+							skip_to_first4( first, l );
 						}
 						if constexpr( ParseState::is_zero_terminated_string ) {
-							if constexpr( ParseState::exclude_special_escapes ) {
-								while( *first != '\0' ) {
-									char c = *first;
-									daw_json_ensure( static_cast<unsigned char>( c ) >= 0x20U,
-									                 ErrorReason::InvalidString, parse_state );
-									if( c == '\\' ) {
-										daw_json_ensure( last - first > 1,
-										                 ErrorReason::InvalidString, parse_state );
-										if( need_slow_path < 0 ) {
-											need_slow_path = first - parse_state.first;
-										}
-										++first;
-										c = *first;
-										switch( c ) {
-										case '"':
-										case '\\':
-										case '/':
-										case 'b':
-										case 'f':
-										case 'n':
-										case 'r':
-										case 't':
-										case 'u':
-											break;
-										default:
-											daw_json_error( ErrorReason::InvalidString, parse_state );
-										}
-									} else if( c == '"' ) {
-										break;
-									}
+							while( ( *first != 0 ) & ( *first != '"' ) ) {
+								while( ( *first != 0 ) & ( *first != '"' ) &
+								       ( *first != '\\' ) ) {
 									++first;
 								}
-							} else {
-								while( ( *first != 0 ) & ( *first != '"' ) ) {
-									while( ( *first != 0 ) & ( *first != '"' ) &
-									       ( *first != '\\' ) ) {
-										++first;
-									}
 
-									if( ( ( *first != 0 ) & ( *first == '\\' ) ) ) {
-										if( need_slow_path < 0 ) {
-											need_slow_path = first - parse_state.first;
-										}
-										first += 2;
-									} else {
-										break;
+								if( ( ( *first != 0 ) & ( *first == '\\' ) ) ) {
+									if( need_slow_path < 0 ) {
+										need_slow_path = first - parse_state.first;
 									}
+									first += 2;
+								} else {
+									break;
 								}
 							}
 						} else {
-							if constexpr( ParseState::exclude_special_escapes ) {
-								while( first < last ) {
-									char c = *first;
-									daw_json_ensure( static_cast<unsigned char>( c ) >= 0x20U,
-									                 ErrorReason::InvalidString, parse_state );
-									if( c == '\\' ) {
-										daw_json_ensure( last - first > 1,
-										                 ErrorReason::InvalidString, parse_state );
-										if( need_slow_path < 0 ) {
-											need_slow_path = first - parse_state.first;
-										}
-										++first;
-										c = *first;
-										switch( c ) {
-										case '"':
-										case '\\':
-										case '/':
-										case 'b':
-										case 'f':
-										case 'n':
-										case 'r':
-										case 't':
-										case 'u':
-											break;
-										default:
-											daw_json_error( ErrorReason::InvalidString, parse_state );
-										}
-									} else if( c == '"' ) {
-										break;
-									}
+							while( first < last and *first != '"' ) {
+								while( first < last and
+								       ( ( *first != '"' ) & ( *first != '\\' ) ) ) {
 									++first;
 								}
-							} else {
-								while( first < last and *first != '"' ) {
-									while( first < last and
-									       ( ( *first != '"' ) & ( *first != '\\' ) ) ) {
-										++first;
-									}
 
-									if( first < last and *first == '\\' ) {
-										if( need_slow_path < 0 ) {
-											need_slow_path = first - parse_state.first;
-										}
-										first += 2;
-									} else {
-										break;
+								if( first < last and *first == '\\' ) {
+									if( need_slow_path < 0 ) {
+										need_slow_path = first - parse_state.first;
 									}
+									first += 2;
+								} else {
+									break;
 								}
 							}
 						}
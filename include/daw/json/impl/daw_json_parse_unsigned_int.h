@@ -11,6 +11,7 @@
 #include "version.h"
 
 #include "daw_json_assert.h"
+#include "daw_json_cpu_features.h"
 #include "daw_json_exec_modes.h"
 #include "daw_json_parse_digit.h"
 #include "daw_json_parse_unsigned_int.h"
@@ -23,6 +24,7 @@
 #include <daw/daw_uint_buffer.h>
 
 #include <cstddef>
+#include <cstdint>
 #include <daw/stdinc/data_access.h>
 #include <limits>
 
@@ -35,6 +37,9 @@
 #include <intrin.h>
 #endif
 #endif
+#if defined( DAW_JSON_HAS_RUNTIME_CPU_DISPATCH )
+#include <immintrin.h>
+#endif
 
 namespace daw::json {
 	inline namespace DAW_JSON_VER {
@@ -129,6 +134,102 @@ namespace daw::json {
 			                 1234567890123456_u64,
 			               "16 digit parser does not work on this platform" );
 
+			DAW_ATTRIB_INLINE constexpr UInt64
+			parse_16_digits( constexpr_exec_tag, char const *const str ) {
+				return parse_16_digits( str );
+			}
+
+			DAW_ATTRIB_INLINE constexpr bool
+			is_made_of_sixteen_digits( constexpr_exec_tag, char const *ptr ) {
+				return is_made_of_eight_digits_cx( ptr ) and
+				       is_made_of_eight_digits_cx( ptr + 8 );
+			}
+
+#if defined( DAW_ALLOW_SSE42 ) or defined( DAW_JSON_HAS_RUNTIME_CPU_DISPATCH )
+			/***
+			 * The 16 digit kernels check and convert a whole 16 byte block.  The
+			 * conversion adds the pairs of digits, then the pairs of those, with
+			 * pmaddubsw and pmaddwd until the two halves of 8 digits are left.
+			 * They need SSE4.1, which the hosts of the sse42, avx2 and avx512 exec
+			 * modes have.  Adapted from
+			 * https://kholdstare.github.io/technical/2020/05/26/faster-integer-parsing.html
+			 */
+			DAW_JSON_TARGET_SSE41 inline bool
+			is_made_of_sixteen_digits_sse41( char const *ptr ) {
+				__m128i const digits = _mm_sub_epi8(
+				  _mm_loadu_si128( reinterpret_cast<__m128i const *>( ptr ) ),
+				  _mm_set1_epi8( '0' ) );
+				// Unsigned digits <= 9 is max( digits, 9 ) == 9
+				__m128i const nines = _mm_set1_epi8( 9 );
+				return _mm_movemask_epi8( _mm_cmpeq_epi8(
+				         _mm_max_epu8( digits, nines ), nines ) ) == 0xFFFF;
+			}
+
+			DAW_JSON_TARGET_SSE41 inline UInt64
+			parse_16_digits_sse41( char const *ptr ) {
+				__m128i const digits = _mm_sub_epi8(
+				  _mm_loadu_si128( reinterpret_cast<__m128i const *>( ptr ) ),
+				  _mm_set1_epi8( '0' ) );
+				// The bytes 10, 1 repeated
+				__m128i const pairs =
+				  _mm_maddubs_epi16( digits, _mm_set1_epi16( 0x010A ) );
+				__m128i const quads = _mm_madd_epi16(
+				  pairs, _mm_setr_epi16( 100, 1, 100, 1, 100, 1, 100, 1 ) );
+				__m128i const octs =
+				  _mm_madd_epi16( _mm_packus_epi32( quads, quads ),
+				                  _mm_setr_epi16( 10000, 1, 10000, 1, 0, 0, 0, 0 ) );
+				auto const upper =
+				  static_cast<std::uint32_t>( _mm_cvtsi128_si32( octs ) );
+				auto const lower =
+				  static_cast<std::uint32_t>( _mm_extract_epi32( octs, 1 ) );
+				return to_uint64( upper ) * 100'000'000_u64 + to_uint64( lower );
+			}
+#endif
+
+#if defined( DAW_ALLOW_SSE42 )
+			DAW_ATTRIB_INLINE bool is_made_of_sixteen_digits( sse42_exec_tag,
+			                                                  char const *ptr ) {
+				return is_made_of_sixteen_digits_sse41( ptr );
+			}
+
+			DAW_ATTRIB_INLINE UInt64 parse_16_digits( sse42_exec_tag,
+			                                          char const *ptr ) {
+				return parse_16_digits_sse41( ptr );
+			}
+#endif
+
+#if defined( DAW_JSON_HAS_RUNTIME_CPU_DISPATCH )
+			DAW_JSON_TARGET_AVX2 inline bool
+			is_made_of_sixteen_digits( avx2_exec_tag, char const *ptr ) {
+				return is_made_of_sixteen_digits_sse41( ptr );
+			}
+
+			DAW_JSON_TARGET_AVX2 inline UInt64 parse_16_digits( avx2_exec_tag,
+			                                                    char const *ptr ) {
+				return parse_16_digits_sse41( ptr );
+			}
+#endif
+
+			inline bool is_made_of_sixteen_digits( best_available_exec_tag,
+			                                       char const *ptr ) {
+#if defined( DAW_JSON_HAS_RUNTIME_CPU_DISPATCH )
+				if( best_simd_level( ) != simd_level::none ) {
+					return is_made_of_sixteen_digits( avx2_exec_tag{ }, ptr );
+				}
+#endif
+				return is_made_of_sixteen_digits( constexpr_exec_tag{ }, ptr );
+			}
+
+			inline UInt64 parse_16_digits( best_available_exec_tag,
+			                               char const *ptr ) {
+#if defined( DAW_JSON_HAS_RUNTIME_CPU_DISPATCH )
+				if( best_simd_level( ) != simd_level::none ) {
+					return parse_16_digits( avx2_exec_tag{ }, ptr );
+				}
+#endif
+				return parse_16_digits( ptr );
+			}
+
 			template<typename T>
 			struct make_unsigned_with_bool : daw::make_unsigned<T> {};
 
@@ -189,10 +290,9 @@ namespace daw::json {
 			  typename make_unsigned_with_bool<T>::type;
 
 			template<typename Unsigned, options::JsonRangeCheck RangeChecked,
-			         typename ParseState>
+			         typename ExecTag, typename ParseState>
 			[[nodiscard]] static constexpr Unsigned
-			unsigned_parser_known( constexpr_exec_tag const &,
-			                       ParseState &parse_state ) {
+			unsigned_parser_known( ExecTag const &tag, ParseState &parse_state ) {
 				using CharT = typename ParseState::CharT;
 				// We know how many digits are in the number
 				using result_t = max_unsigned_t<RangeChecked, Unsigned, UInt64>;
@@ -210,7 +310,7 @@ namespace daw::json {
 
 				while( last - first >= 16 ) {
 					result *= static_cast<uresult_t>( 10'000'000'000'000'000ULL );
-					result += static_cast<uresult_t>( parse_16_digits( first ) );
+					result += static_cast<uresult_t>( parse_16_digits( tag, first ) );
 					first += 16;
 				}
 				if( last - first >= 8 ) {
@@ -253,10 +353,9 @@ namespace daw::json {
 
 			//**************************
 			template<typename Unsigned, options::JsonRangeCheck RangeChecked,
-			         typename ParseState>
+			         typename ExecTag, typename ParseState>
 			[[nodiscard]] static constexpr Unsigned
-			unsigned_parser_not_known( constexpr_exec_tag const &,
-			                           ParseState &parse_state ) {
+			unsigned_parser_not_known( ExecTag const &tag, ParseState &parse_state ) {
 				using CharT = typename ParseState::CharT;
 				// We do not know how long the string is
 				using result_t = max_unsigned_t<RangeChecked, Unsigned, UInt64>;
@@ -274,22 +373,14 @@ namespace daw::json {
 				(void)orig_first; // only used inside if constexpr and gcc9 warns
 				CharT *const last = parse_state.last;
 				uresult_t result = uresult_t( );
-				bool has_eight =
-				  last - first >= 8 ? is_made_of_eight_digits_cx( first ) : false;
-				if( has_eight & ( last - first >= 16 ) ) {
-					bool has_sixteen = is_made_of_eight_digits_cx( first + 8 );
-					while( has_sixteen ) {
-						result *= static_cast<uresult_t>( 10'000'000'000'000'000ULL );
-						result += static_cast<uresult_t>( parse_16_digits( first ) );
-						first += 16;
-						has_eight =
-						  last - first >= 8 ? is_made_of_eight_digits_cx( first ) : false;
-						has_sixteen =
-						  has_eight and
-						  ( last - first >= 16 ? is_made_of_eight_digits_cx( first + 8 )
-						                       : false );
-					}
+				while( ( last - first >= 16 ) and
+				       is_made_of_sixteen_digits( tag, first ) ) {
+					result *= static_cast<uresult_t>( 10'000'000'000'000'000ULL );
+					result += static_cast<uresult_t>( parse_16_digits( tag, first ) );
+					first += 16;
 				}
+				bool const has_eight =
+				  last - first >= 8 ? is_made_of_eight_digits_cx( first ) : false;
 				if( has_eight ) {
 					result *= static_cast<uresult_t>( 100'000'000ULL );
 					result += static_cast<uresult_t>( parse_8_digits( first ) );
@@ -333,125 +424,16 @@ namespace daw::json {
 				}
 			}
 
-#if false and defined( DAW_ALLOW_SSE42 )
-			/*
-			// Adapted from
-			//
-			//
-			https://github.com/lemire/simdjson/blob/102262c7abe64b517a36a6049b39d95f58bf4aea/src/haswell/numberparsing.h
-			inline UInt64 parse_eight_digits_unrolled( char const *ptr ) {
-			  // this actually computes *16* values so we are being wasteful.
-			  static __m128i const ascii0 = _mm_set1_epi8( '0' );
-
-			  static __m128i const mul_1_10 =
-			    _mm_setr_epi8( 10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1
-			);
-
-			  static __m128i const mul_1_100 =
-			    _mm_setr_epi16( 100, 1, 100, 1, 100, 1, 100, 1 );
-
-			  static __m128i const mul_1_10000 =
-			    _mm_setr_epi16( 10000, 1, 10000, 1, 10000, 1, 10000, 1 );
-
-			  __m128i const input = _mm_sub_epi8(
-			    _mm_loadu_si128( reinterpret_cast<__m128i const *>( ptr ) ), ascii0 );
-			  __m128i const t1 = _mm_maddubs_epi16( input, mul_1_10 );
-			  __m128i const t2 = _mm_madd_epi16( t1, mul_1_100 );
-			  __m128i const t3 = _mm_packus_epi32( t2, t2 );
-			  __m128i const t4 = _mm_madd_epi16( t3, mul_1_10000 );
-			  return to_uint64( static_cast<std::uint32_t>( _mm_cvtsi128_si32(
-			    t4 ) ) ); // only captures the sum of the first 8 digits, drop the
-			rest
-			}
-
-			inline UInt64 parse_sixteen_digits_unrolled( char const *ptr ) {
-			  static __m128i const ascii0 = _mm_set1_epi8( '0' );
-
-			  static __m128i const mul_1_10 =
-			    _mm_setr_epi8( 10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1
-			);
-
-			  static __m128i const mul_1_100 =
-			    _mm_setr_epi16( 100, 1, 100, 1, 100, 1, 100, 1 );
-
-			  static __m128i const mul_1_10000 =
-			    _mm_setr_epi16( 10000, 1, 10000, 1, 10000, 1, 10000, 1 );
-
-			  __m128i const input = _mm_sub_epi8(
-			    _mm_loadu_si128( reinterpret_cast<__m128i const *>( ptr ) ), ascii0 );
-			  __m128i const t1 = _mm_maddubs_epi16( input, mul_1_10 );
-			  __m128i const t2 = _mm_madd_epi16( t1, mul_1_100 );
-			  __m128i const t3 = _mm_packus_epi32( t2, t2 );
-			  __m128i const t4 = _mm_madd_epi16( t3, mul_1_10000 );
-			  return to_uint64( _mm_cvtsi128_si64( t4 ) );
-			}
-
-			[[nodiscard]] inline bool
-			is_made_of_eight_digits_fast( char const *ptr ) {
-			  UInt64 val;
-			  memcpy( &val, ptr, sizeof( std::uint64_t ) );
-			  return ( ( ( val & 0xF0F0F0F0F0F0F0F0_u64 ) |
-			             ( ( ( val + 0x0606060606060606_u64 ) & 0xF0F0F0F0F0F0F0F0_u64
-			)
-			>> 4_u64 ) ) == 0x3333333333333333_u64 );
-			}
-
-			template<typename Unsigned, options::JsonRangeCheck RangeChecked, bool, typename
-			ParseState>
-			[[nodiscard]] inline Unsigned
-			unsigned_parser( sse42_exec_tag const &, ParseState &parse_state ) {
-			  daw_json_assert_weak( parse_state.has_more( ),
-			ErrorRange::UnexpectedEndOfData, parse_state
-			); using result_t = max_unsigned_t<RangeChecked, Unsigned, UInt64>;
-			result_t result = result_t( ); CharT *first = parse_state.first; CharT
-			 *const last = parse_state.last; CharT *const orig_first =
-			first;
-			  {
-			    auto sz = last - first;
-			    while( ( sz >= 8 ) & is_made_of_eight_digits_fast( first ) ) {
-			      if( ( sz < 16 ) | ( not is_made_of_eight_digits_fast( first + 8 ) )
-			) { result *= 100'000'000_u64; result += static_cast<result_t>(
-			parse_eight_digits_unrolled( first ) ); first += 8; break;
-			      }
-			      result *= 10'000'000'000'000'000_u64;
-			      result +=
-			        static_cast<result_t>( parse_sixteen_digits_unrolled( first ) );
-			      sz -= 16;
-			      first += 16;
-			    }
-			  }
-
-			  auto dig = parse_digit( *first );
-			  while( dig < 10U ) {
-			    result *= 10U;
-			    result += dig;
-			    ++first;
-			    dig = parse_digit( *first );
-			  }
-			  if constexpr( RangeChecked != options::JsonRangeCheck::Never ) {
-			    auto const count =
-			      static_cast<intmax_t>( daw::numeric_limits<Unsigned>::digits10 + 1 )
-			- ( first - orig_first ); daw_json_ensure( (count >= 0) & (result <=
-			static_cast<result_t>( (daw::numeric_limits<Unsigned>::max)( ) )),
-			                                   ErrorReason::NumberOutOfRange,
-			parse_state
-			);
-			  }
-			  parse_state.first = first;
-			  if constexpr( RangeChecked == options::JsonRangeCheck::Never ) {
-			    return daw::construct_a<Unsigned>( static_cast<Unsigned>( result ) );
-			  } else {
-			    return daw::construct_a<Unsigned>( narrow_cast<Unsigned>( result, parse_state ) );
-			  }
-			}
+			/***
+			 * Parse the digits at the front of parse_state.  Runs of 16 digits are
+			 * checked and converted with SSE4.1 in the simd exec mode and when the
+			 * host has AVX2 in the avx2, avx512 and best_available exec modes.  The
+			 * others use the SWAR kernels
 			 */
-#endif
-
 			template<typename Unsigned, options::JsonRangeCheck RangeChecked,
-			         bool KnownBounds, typename ParseState>
+			         bool KnownBounds, typename ExecTag, typename ParseState>
 			[[nodiscard]] DAW_ATTRIB_INLINE static constexpr Unsigned
-			unsigned_parser( constexpr_exec_tag const &tag,
-			                 ParseState &parse_state ) {
+			unsigned_parser( ExecTag const &tag, ParseState &parse_state ) {
 				if constexpr( KnownBounds ) {
 					return unsigned_parser_known<Unsigned, RangeChecked>( tag,
 					                                                      parse_state );
@@ -10,6 +10,7 @@
 
 #include "version.h"
 
+#include "daw_json_array_count.h"
 #include "daw_json_assert.h"
 #include "daw_json_parse_array_iterator.h"
 #include "daw_json_parse_kv_array_iterator.h"
@@ -38,6 +39,7 @@
 #include <daw/stdinc/data_access.h>
 #include <daw/stdinc/tuple_traits.h>
 #include <type_traits>
+#include <vector>
 
 namespace daw::json {
 	inline namespace DAW_JSON_VER {
@@ -435,7 +437,23 @@ namespace daw::json {
 			parse_value_string_raw( ParseState &parse_state ) {
 
 				using constructor_t = json_constructor_t<JsonMember>;
-				if constexpr( KnownBounds ) {
+				if constexpr( ParseState::unescape_in_place and
+				              JsonMember::allow_escape_character ==
+				                options::AllowEscapeCharacter::Allow ) {
+					auto const str = KnownBounds ? parse_state : skip_string( parse_state );
+					if( needs_slow_path( str ) ) {
+						using AllowHighEightbits =
+						  std::bool_constant<JsonMember::eight_bit_mode !=
+						                     options::EightBitModes::DisallowHigh>;
+						char const *const last =
+						  unescape_string_in_place<AllowHighEightbits::value>( str );
+						return construct_value<json_result_t<JsonMember>, constructor_t>(
+						  parse_state, std::data( str ),
+						  static_cast<std::size_t>( last - std::data( str ) ) );
+					}
+					return construct_value<json_result_t<JsonMember>, constructor_t>(
+					  parse_state, std::data( str ), std::size( str ) );
+				} else if constexpr( KnownBounds ) {
 					return construct_value<json_result_t<JsonMember>, constructor_t>(
 					  parse_state, std::data( parse_state ), std::size( parse_state ) );
 				} else {
@@ -490,6 +508,18 @@ namespace daw::json {
 					                     options::EightBitModes::DisallowHigh>;
 					auto parse_state2 =
 					  KnownBounds ? parse_state : skip_string( parse_state );
+					if constexpr( ParseState::unescape_in_place ) {
+						if( needs_slow_path( parse_state2 ) ) {
+							// There are escapes in the string, construct from the decoded
+							// bytes
+							char const *const last =
+							  unescape_string_in_place<AllowHighEightbits::value>(
+							    parse_state2 );
+							return construct_value<json_result_t<JsonMember>,
+							                       constructor_t>(
+							  parse_state, std::data( parse_state2 ), last );
+						}
+					}
 					if( not AllowHighEightbits::value or
 					    needs_slow_path( parse_state2 ) ) {
 						// There are escapes in the string
@@ -508,6 +538,18 @@ namespace daw::json {
 					using AllowHighEightbits =
 					  std::bool_constant<JsonMember::eight_bit_mode !=
 					                     options::EightBitModes::DisallowHigh>;
+					if constexpr( ParseState::unescape_in_place ) {
+						if( needs_slow_path( parse_state2 ) ) {
+							// There are escapes in the string, construct from the decoded
+							// bytes
+							char const *const last =
+							  unescape_string_in_place<AllowHighEightbits::value>(
+							    parse_state2 );
+							return construct_value<json_result_t<JsonMember>,
+							                       constructor_t>(
+							  parse_state, std::data( parse_state2 ), last );
+						}
+					}
 					if( not AllowHighEightbits::value or
 					    needs_slow_path( parse_state2 ) ) {
 						// There are escapes in the string
@@ -669,14 +711,106 @@ namespace daw::json {
 				  parse_state, iter_t( parse_state ), iter_t( ) );
 			}
 
+			/***
+			 * Move parse_state past the opening bracket of an array and count the
+			 * elements of the array.  With KnownBounds the array was skipped before
+			 * and parse_state.counter holds its top level commas.  See
+			 * options::ExactArraySizing
+			 */
+			template<bool KnownBounds, typename ParseState>
+			[[nodiscard]] static constexpr std::size_t
+			open_and_count_array( ParseState &parse_state ) {
+				auto array_state = parse_state;
+				parse_state.remove_prefix( );
+				parse_state.trim_left_unchecked( );
+				if( not parse_state.has_more( ) or parse_state.front( ) == ']' ) {
+					return 0;
+				}
+				if constexpr( KnownBounds ) {
+					(void)array_state;
+					return parse_state.counter + 1U;
+				} else {
+					if constexpr( can_skip_bracketed_wide_v<
+					                typename ParseState::exec_tag_t> ) {
+						if( has_wide_kernels( ParseState::exec_tag ) ) {
+							return count_array_elements(
+							  ParseState::exec_tag, parse_state.first, parse_state.last );
+						}
+					}
+					// Skipping the array counts its top level commas with the byte loop
+					// of the parse policy, which can be done in a constant expression
+					return array_state.skip_array( ).counter + 1U;
+				}
+			}
+
+			template<typename JsonElement>
+			inline constexpr bool is_number_element_v =
+			  JsonElement::expected_type == JsonParseTypes::Real or
+			  JsonElement::expected_type == JsonParseTypes::Signed or
+			  JsonElement::expected_type == JsonParseTypes::Unsigned;
+
+			/***
+			 * The array is a std::vector of numbers built by the default
+			 * constructor, the elements can be appended directly without going
+			 * through json_parse_array_iterator
+			 */
+			template<typename JsonMember, typename ParseState>
+			inline constexpr bool is_number_array_v =
+			  not ParseState::has_allocator and
+			  is_number_element_v<typename JsonMember::json_element_t> and
+			  std::is_same_v<json_constructor_t<JsonMember>,
+			                 default_constructor<std::vector<json_result_t<
+			                   typename JsonMember::json_element_t>>>>;
+
+			/***
+			 * Parse the elements of an array of numbers into a std::vector.
+			 * parse_state is positioned at the first element or the closing
+			 * bracket.  Numbers are followed directly by a comma in most documents
+			 * so that is checked before the whitespace is trimmed
+			 * @param reserve_count Expected number of elements
+			 */
+			template<typename JsonMember, bool KnownBounds, typename ParseState>
+			[[nodiscard]] static DAW_JSON_CX_VECTOR json_result_t<JsonMember>
+			parse_number_array( ParseState &parse_state,
+			                    std::size_t reserve_count ) {
+				using element_t = typename JsonMember::json_element_t;
+				auto result = json_result_t<JsonMember>( );
+				result.reserve( reserve_count );
+				daw_json_assert_weak( parse_state.has_more( ),
+				                      ErrorReason::UnexpectedEndOfData, parse_state );
+				while( parse_state.front( ) != ']' ) {
+					result.push_back(
+					  parse_value<element_t, false, element_t::expected_type>(
+					    parse_state ) );
+					if( DAW_LIKELY( parse_state.has_more( ) and
+					                parse_state.front( ) == ',' ) ) {
+						parse_state.remove_prefix( );
+						parse_state.trim_left( );
+					} else {
+						parse_state.trim_left( );
+						daw_json_assert_weak(
+						  parse_state.has_more( ) and
+						    parse_state.is_at_next_array_element( ),
+						  ErrorReason::UnexpectedEndOfData, parse_state );
+						parse_state.move_next_member_or_end( );
+					}
+					daw_json_assert_weak( parse_state.has_more( ),
+					                      ErrorReason::UnexpectedEndOfData,
+					                      parse_state );
+				}
+				if constexpr( not KnownBounds ) {
+					parse_state.remove_prefix( );
+					parse_state.trim_left_checked( );
+				}
+				return result;
+			}
+
 			template<typename JsonMember, bool KnownBounds, typename ParseState>
 			[[nodiscard]] static constexpr json_result_t<JsonMember>
 			parse_value_array( ParseState &parse_state ) {
 				parse_state.trim_left( );
 				daw_json_assert_weak( parse_state.is_opening_bracket_checked( ),
 				                      ErrorReason::InvalidArrayStart, parse_state );
-				parse_state.remove_prefix( );
-				parse_state.trim_left_unchecked( );
 				// TODO: add parse option to disable random access iterators. This is
 				// coding to the implementations
 
@@ -684,8 +818,32 @@ namespace daw::json {
 				  json_parse_array_iterator<JsonMember, ParseState,
 				                            can_be_random_iterator_v<KnownBounds>>;
 				using constructor_t = json_constructor_t<JsonMember>;
-				return construct_value<json_result_t<JsonMember>, constructor_t>(
-				  parse_state, iterator_t( parse_state ), iterator_t( ) );
+				if constexpr( is_number_array_v<JsonMember, ParseState> ) {
+					using value_t = json_result_t<typename JsonMember::json_element_t>;
+					// Same 4k page guess as the default vector constructor
+					std::size_t reserve_count = 4096U / ( sizeof( value_t ) * 8U );
+					if constexpr( KnownBounds or ParseState::exact_array_sizing ) {
+						// With KnownBounds the count is free
+						reserve_count = open_and_count_array<KnownBounds>( parse_state );
+					} else {
+						parse_state.remove_prefix( );
+						parse_state.trim_left_unchecked( );
+					}
+					return parse_number_array<JsonMember, KnownBounds>( parse_state,
+					                                                    reserve_count );
+				} else if constexpr( ParseState::exact_array_sizing and
+				              std::is_invocable_v<constructor_t, iterator_t, iterator_t,
+				                                  element_count_hint> ) {
+					auto const count = open_and_count_array<KnownBounds>( parse_state );
+					return construct_value<json_result_t<JsonMember>, constructor_t>(
+					  parse_state, iterator_t( parse_state ), iterator_t( ),
+					  element_count_hint{ count } );
+				} else {
+					parse_state.remove_prefix( );
+					parse_state.trim_left_unchecked( );
+					return construct_value<json_result_t<JsonMember>, constructor_t>(
+					  parse_state, iterator_t( parse_state ), iterator_t( ) );
+				}
 			}
 
 			template<typename JsonMember, bool KnownBounds, typename ParseState>
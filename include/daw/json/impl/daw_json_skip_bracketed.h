@@ -0,0 +1,235 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#pragma once
+
+#include "version.h"
+
+#include "daw_json_cpu_features.h"
+#include "daw_json_exec_modes.h"
+#include "daw_not_const_ex_functions.h"
+
+#include <daw/daw_attributes.h>
+#include <daw/daw_likely.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace daw::json {
+	inline namespace DAW_JSON_VER {
+		namespace json_details {
+			struct bracket_skip_block_masks {
+				std::uint64_t commas;
+				std::uint64_t prime_opens;
+				std::uint64_t prime_closes;
+				std::uint64_t sec_opens;
+				std::uint64_t sec_closes;
+				std::uint64_t quotes;
+				std::uint64_t backslashes;
+			};
+
+			template<char PrimLeft>
+			inline bracket_skip_block_masks
+			classify_bracket_skip_block( runtime_exec_tag, char const *ptr ) {
+				constexpr char PrimRight = PrimLeft == '{' ? '}' : ']';
+				constexpr char SecLeft = PrimLeft == '{' ? '[' : '{';
+				constexpr char SecRight = SecLeft == '{' ? '}' : ']';
+				auto result = bracket_skip_block_masks{ 0, 0, 0, 0, 0, 0, 0 };
+				for( unsigned n = 0; n < 64U; ++n ) {
+					auto const bit = std::uint64_t{ 1 } << n;
+					switch( ptr[n] ) {
+					case ',':
+						result.commas |= bit;
+						break;
+					case PrimLeft:
+						result.prime_opens |= bit;
+						break;
+					case PrimRight:
+						result.prime_closes |= bit;
+						break;
+					case SecLeft:
+						result.sec_opens |= bit;
+						break;
+					case SecRight:
+						result.sec_closes |= bit;
+						break;
+					case '"':
+						result.quotes |= bit;
+						break;
+					case '\\':
+						result.backslashes |= bit;
+						break;
+					}
+				}
+				return result;
+			}
+
+#if defined( DAW_JSON_HAS_RUNTIME_CPU_DISPATCH )
+			/// Can the parse policies skip with skip_bracketed_blocks in the exec
+			/// mode.  The byte loop is faster without the wide kernels
+			template<typename ExecTag>
+			inline constexpr bool can_skip_bracketed_wide_v =
+			  is_wide_exec_tag_v<ExecTag> or
+			  std::is_same_v<ExecTag, best_available_exec_tag>;
+
+			template<typename ExecTag>
+			DAW_ATTRIB_INLINE bool has_wide_kernels( ExecTag ) {
+				if constexpr( is_wide_exec_tag_v<ExecTag> ) {
+					return true;
+				} else {
+					return best_simd_level( ) != simd_level::none;
+				}
+			}
+
+			template<char PrimLeft, typename ExecTag,
+			         std::enable_if_t<is_wide_exec_tag_v<ExecTag>, std::nullptr_t> =
+			           nullptr>
+			inline bracket_skip_block_masks
+			classify_bracket_skip_block( ExecTag tag, char const *ptr ) {
+				constexpr char PrimRight = PrimLeft == '{' ? '}' : ']';
+				constexpr char SecLeft = PrimLeft == '{' ? '[' : '{';
+				constexpr char SecRight = SecLeft == '{' ? '}' : ']';
+				auto const qb = find_quotes_and_backslashes64( tag, ptr );
+				return bracket_skip_block_masks{ mem_find_eq64<','>( tag, ptr ),
+				                                 mem_find_eq64<PrimLeft>( tag, ptr ),
+				                                 mem_find_eq64<PrimRight>( tag, ptr ),
+				                                 mem_find_eq64<SecLeft>( tag, ptr ),
+				                                 mem_find_eq64<SecRight>( tag, ptr ),
+				                                 qb.quotes,
+				                                 qb.backslashes };
+			}
+#else
+			template<typename ExecTag>
+			inline constexpr bool can_skip_bracketed_wide_v = false;
+#endif
+
+			template<typename CharT>
+			struct bracket_skip_result {
+				/// One past the closing bracket, nullptr when the data ends first
+				CharT *value_last;
+				/// The commas that separate the top level members or elements
+				std::size_t commas;
+				/// The other kind of bracket was balanced when the value closed
+				bool is_balanced;
+				/// The data ended inside a string
+				bool ends_in_string;
+			};
+
+			/***
+			 * Skip the class or array whose opening bracket is before first, 64
+			 * bytes at a time.  Strings are found with string_block_scanner.  A
+			 * block that cannot close the value or contain one of its top level
+			 * commas only updates the bracket counts with popcounts, the others are
+			 * walked one bracket or comma at a time.  This counts the same commas
+			 * and checks the same brackets as the byte loop of the parse policies
+			 */
+			template<char PrimLeft, typename ExecTag, typename CharT>
+			bracket_skip_result<CharT> skip_bracketed_blocks( ExecTag tag,
+			                                                  CharT *first,
+			                                                  CharT *const last ) {
+				if constexpr( std::is_same_v<ExecTag, best_available_exec_tag> ) {
+#if defined( DAW_JSON_HAS_RUNTIME_CPU_DISPATCH )
+					switch( best_simd_level( ) ) {
+					case simd_level::avx512:
+						return skip_bracketed_blocks<PrimLeft>( avx512_exec_tag{ }, first,
+						                                        last );
+					case simd_level::avx2:
+						return skip_bracketed_blocks<PrimLeft>( avx2_exec_tag{ }, first,
+						                                        last );
+					case simd_level::none:
+						break;
+					}
+#endif
+					return skip_bracketed_blocks<PrimLeft>( runtime_exec_tag{ }, first,
+					                                        last );
+				} else {
+					constexpr char PrimRight = PrimLeft == '{' ? '}' : ']';
+					constexpr char SecLeft = PrimLeft == '{' ? '[' : '{';
+					constexpr char SecRight = SecLeft == '{' ? '}' : ']';
+
+					auto result = bracket_skip_result<CharT>{ nullptr, 0, true, false };
+					std::int64_t prime_bracket_count = 1;
+					std::int64_t second_bracket_count = 0;
+					auto scanner = string_block_scanner{ };
+					auto const count = []( std::uint64_t bits ) {
+						return static_cast<std::int64_t>( popcount64( bits ) );
+					};
+					// Returns true when the closing bracket is found
+					bool const found = for_each_block64(
+					  first, last, [&]( char const *block, CharT *block_first ) {
+						  auto const m =
+						    classify_bracket_skip_block<PrimLeft>( tag, block );
+						  auto const strings = scanner.next( m.quotes, m.backslashes );
+						  std::uint64_t const structural =
+						    ~( strings.in_string | strings.escaped );
+						  std::uint64_t const commas = m.commas & structural;
+						  std::uint64_t const prime_opens = m.prime_opens & structural;
+						  std::uint64_t const prime_closes = m.prime_closes & structural;
+						  std::uint64_t const sec_opens = m.sec_opens & structural;
+						  std::uint64_t const sec_closes = m.sec_closes & structural;
+						  std::uint64_t const brackets =
+						    prime_opens | prime_closes | sec_opens | sec_closes;
+						  if( brackets == 0 ) {
+							  if( ( prime_bracket_count == 1 ) &
+							      ( second_bracket_count == 0 ) ) {
+								  result.commas += popcount64( commas );
+							  }
+							  return false;
+						  }
+						  auto const prime_close_count = count( prime_closes );
+						  auto const close_count = prime_close_count + count( sec_closes );
+						  if( DAW_LIKELY( ( prime_bracket_count > prime_close_count ) &
+						                  ( prime_bracket_count + second_bracket_count >=
+						                    close_count + 2 ) ) ) {
+							  // The depth stays above the top level for the whole block
+							  prime_bracket_count += count( prime_opens ) - prime_close_count;
+							  second_bracket_count +=
+							    count( sec_opens ) - count( sec_closes );
+							  return false;
+						  }
+						  std::uint64_t bits = commas | brackets;
+						  while( bits != 0 ) {
+							  auto const idx = ctz64( bits );
+							  switch( block[idx] ) {
+							  case ',':
+								  if( ( prime_bracket_count == 1 ) &
+								      ( second_bracket_count == 0 ) ) {
+									  ++result.commas;
+								  }
+								  break;
+							  case PrimLeft:
+								  ++prime_bracket_count;
+								  break;
+							  case PrimRight:
+								  if( --prime_bracket_count == 0 ) {
+									  result.value_last = block_first + idx + 1;
+									  result.is_balanced = second_bracket_count == 0;
+									  return true;
+								  }
+								  break;
+							  case SecLeft:
+								  ++second_bracket_count;
+								  break;
+							  case SecRight:
+								  --second_bracket_count;
+								  break;
+							  }
+							  bits &= bits - 1U;
+						  }
+						  return false;
+					  } );
+					if( not found ) {
+						result.ends_in_string = scanner.ends_in_string( );
+					}
+					return result;
+				}
+			}
+		} // namespace json_details
+	} // namespace DAW_JSON_VER
+} // namespace daw::json
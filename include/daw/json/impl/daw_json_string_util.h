@@ -178,7 +178,8 @@ namespace daw::json {
 					if( ( not is_cxeval ) |
 					    daw::traits::not_same_v<ExecTag, constexpr_exec_tag> ) {
 
-						return mem_move_to_next_of<false, chars...>( first, last );
+						return mem_move_to_next_of<false, chars...>( ExecTag{ }, first,
+						                                             last );
 					}
 					while( DAW_LIKELY( first < last ) and
 					       not parse_policy_details::in<chars...>( *first ) ) {
@@ -203,8 +204,8 @@ namespace daw::json {
 					return mempbrk_unchecked<ExecTag, expect_long, chars...>( first,
 					                                                          last );
 				} else {
-					return mempbrk_unchecked<ExecTag, expect_long, chars...>( first,
-					                                                          last );
+					return mempbrk_checked<ExecTag, expect_long, chars...>( first,
+					                                                        last );
 				}
 			}
 		} // namespace json_details
@@ -0,0 +1,220 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#pragma once
+
+#include "version.h"
+
+#include "daw_json_cpu_features.h"
+#include "daw_json_exec_modes.h"
+#include "daw_not_const_ex_functions.h"
+
+#include <daw/daw_attributes.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace daw::json {
+	inline namespace DAW_JSON_VER {
+		namespace json_details {
+			struct structural_block_masks {
+				std::uint64_t structurals;
+				std::uint64_t quotes;
+				std::uint64_t backslashes;
+			};
+
+			inline structural_block_masks
+			classify_structural_block( runtime_exec_tag, char const *ptr ) {
+				auto result = structural_block_masks{ 0, 0, 0 };
+				for( unsigned n = 0; n < 64U; ++n ) {
+					auto const bit = std::uint64_t{ 1 } << n;
+					switch( ptr[n] ) {
+					case '{':
+					case '}':
+					case '[':
+					case ']':
+					case ',':
+					case ':':
+						result.structurals |= bit;
+						break;
+					case '"':
+						result.quotes |= bit;
+						break;
+					case '\\':
+						result.backslashes |= bit;
+						break;
+					}
+				}
+				return result;
+			}
+
+#if defined( DAW_JSON_HAS_RUNTIME_CPU_DISPATCH )
+			template<typename ExecTag,
+			         std::enable_if_t<is_wide_exec_tag_v<ExecTag>, std::nullptr_t> =
+			           nullptr>
+			inline structural_block_masks classify_structural_block( ExecTag tag,
+			                                                         char const *ptr ) {
+				auto const qb = find_quotes_and_backslashes64( tag, ptr );
+				return structural_block_masks{
+				  mem_find_eq64<'{', '}', '[', ']', ',', ':'>( tag, ptr ), qb.quotes,
+				  qb.backslashes };
+			}
+#endif
+
+			/***
+			 * Find the offsets of the structural characters({}[],:) that are not
+			 * inside a string and of the opening quote of every string.
+			 */
+			template<typename ExecTag>
+			void build_structural_index( ExecTag tag, char const *first,
+			                             char const *const last,
+			                             std::vector<std::uint32_t> &offsets ) {
+				auto scanner = string_block_scanner{ };
+				(void)for_each_block64(
+				  first, last, [&]( char const *block, char const *block_first ) {
+					  auto const masks = classify_structural_block( tag, block );
+					  auto const strings =
+					    scanner.next( masks.quotes, masks.backslashes );
+					  std::uint64_t bits = ( masks.structurals & ~strings.in_string ) |
+					                       ( strings.quotes & strings.in_string );
+					  auto const base = static_cast<std::uint32_t>( block_first - first );
+					  while( bits != 0 ) {
+						  offsets.push_back( base +
+						                     static_cast<std::uint32_t>( ctz64( bits ) ) );
+						  bits &= bits - 1U;
+					  }
+					  return false;
+				  } );
+			}
+
+			/***
+			 * An index of the structural characters in a JSON document.  It lets
+			 * the parser skip over classes and arrays without looking at the bytes
+			 * inside of their strings.  Documents larger than 4GB are not indexed
+			 * and the parser falls back to scanning them.
+			 */
+			class json_structural_index {
+				char const *m_first = nullptr;
+				char const *m_last = nullptr;
+				std::vector<std::uint32_t> m_offsets{ };
+				// Parsing mostly moves forward, so searches start from the last result
+				mutable std::size_t m_hint = 0;
+
+			public:
+				json_structural_index( ) = default;
+
+				json_structural_index( char const *first, char const *last )
+				  : m_first( first )
+				  , m_last( last ) {
+					auto const sz = static_cast<std::size_t>( last - first );
+					if( sz > static_cast<std::size_t>(
+					           ( std::numeric_limits<std::uint32_t>::max )( ) ) ) {
+						m_first = nullptr;
+						m_last = nullptr;
+						return;
+					}
+					// Structural characters are typically 10-20% of a document
+					m_offsets.reserve( sz / 8U );
+#if defined( DAW_JSON_HAS_RUNTIME_CPU_DISPATCH )
+					switch( best_simd_level( ) ) {
+					case simd_level::avx512:
+						build_structural_index( avx512_exec_tag{ }, first, last,
+						                        m_offsets );
+						return;
+					case simd_level::avx2:
+						build_structural_index( avx2_exec_tag{ }, first, last, m_offsets );
+						return;
+					case simd_level::none:
+						break;
+					}
+#endif
+					build_structural_index( runtime_exec_tag{ }, first, last,
+					                        m_offsets );
+				}
+
+				json_structural_index( json_structural_index const & ) = delete;
+				json_structural_index &
+				operator=( json_structural_index const & ) = delete;
+				json_structural_index( json_structural_index && ) noexcept = default;
+				json_structural_index &
+				operator=( json_structural_index && ) noexcept = default;
+				~json_structural_index( ) = default;
+
+				/// @brief Can the index be used for ptr
+				[[nodiscard]] bool contains( char const *ptr ) const {
+					return m_first != nullptr and ptr >= m_first and ptr <= m_last;
+				}
+
+				[[nodiscard]] char const *doc_first( ) const {
+					return m_first;
+				}
+
+				[[nodiscard]] std::uint32_t const *end( ) const {
+					return m_offsets.data( ) + m_offsets.size( );
+				}
+
+				/// @brief Find the first structural at or after ptr.  ptr must be in
+				/// the document
+				[[nodiscard]] std::uint32_t const *find( char const *ptr ) const {
+					auto const off = static_cast<std::uint32_t>( ptr - m_first );
+					std::uint32_t const *const first = m_offsets.data( );
+					std::uint32_t const *const last = end( );
+					std::uint32_t const *lo = first;
+					std::uint32_t const *hi = last;
+					if( m_hint < m_offsets.size( ) and first[m_hint] <= off ) {
+						// Gallop forward from the hint
+						lo = first + m_hint;
+						std::size_t step = 1;
+						while( static_cast<std::size_t>( last - lo ) > step and
+						       lo[step] <= off ) {
+							lo += step;
+							step *= 2;
+						}
+						if( static_cast<std::size_t>( last - lo ) > step ) {
+							hi = lo + step;
+						}
+					}
+					auto const *result = std::lower_bound( lo, hi, off );
+					m_hint = static_cast<std::size_t>( result - first );
+					return result;
+				}
+			};
+
+			/// @brief Stand in for json_structural_index when
+			/// options::SkipWithStructuralIndex is not enabled.  It keeps from_json
+			/// constexpr
+			struct no_structural_index {};
+
+			template<typename ParseState>
+			[[nodiscard]] constexpr auto
+			make_structural_index( char const *first, char const *last ) {
+				if constexpr( ParseState::skip_with_structural_index ) {
+					return json_structural_index( first, last );
+				} else {
+					(void)first;
+					(void)last;
+					return no_structural_index{ };
+				}
+			}
+
+			template<typename ParseState>
+			DAW_ATTRIB_INLINE constexpr void
+			attach_structural_index( ParseState &, no_structural_index const & ) {}
+
+			template<typename ParseState>
+			DAW_ATTRIB_INLINE void
+			attach_structural_index( ParseState &parse_state,
+			                         json_structural_index const &index ) {
+				parse_state.structural_index = &index;
+			}
+		} // namespace json_details
+	} // namespace DAW_JSON_VER
+} // namespace daw::json
@@ -254,6 +254,17 @@ namespace daw::json {
 			constexpr bool is_mutable_string =
 			  json_details::is_mutable_string_v<String>;
 
+			/// @brief String is a contiguous range of mutable characters.  Unlike
+			/// is_mutable_string_v it is false for types without std::data
+			template<typename String, typename = void>
+			inline constexpr bool is_mutable_buffer_v = false;
+
+			template<typename String>
+			inline constexpr bool is_mutable_buffer_v<
+			  String,
+			  std::void_t<decltype( std::data( std::declval<String &&>( ) ) )>> =
+			  is_mutable_string_v<String>;
+
 			template<typename String>
 			constexpr bool is_rvalue_string = std::is_rvalue_reference_v<String>;
 
@@ -370,18 +370,27 @@ namespace daw::json {
 			/// @brief Construct from string_view
 			explicit inline constexpr basic_json_value( daw::string_view sv )
 			  : m_parse_state( std::data( sv ), daw::data_end( sv ) ) {
+				static_assert( not ParseState::unescape_in_place,
+				               "options::UnescapeInPlace is not supported by "
+				               "json_value" );
 				m_parse_state.trim_left( );
 			}
 
 			/// @brief Construct from CharT *, std::size_t
 			explicit inline constexpr basic_json_value( CharT *first, std::size_t sz )
 			  : m_parse_state( first, first + static_cast<std::ptrdiff_t>( sz ) ) {
+				static_assert( not ParseState::unescape_in_place,
+				               "options::UnescapeInPlace is not supported by "
+				               "json_value" );
 				m_parse_state.trim_left( );
 			}
 
 			/// @brief Construct from CharT *, CharT *
 			explicit inline constexpr basic_json_value( CharT *first, CharT *last )
 			  : m_parse_state( first, last ) {
+				static_assert( not ParseState::unescape_in_place,
+				               "options::UnescapeInPlace is not supported by "
+				               "json_value" );
 				m_parse_state.trim_left( );
 			}
 
@@ -33,8 +33,19 @@
 #endif
 #endif
 
+#include "daw_json_cpu_features.h"
+
+#if defined( DAW_JSON_HAS_RUNTIME_CPU_DISPATCH )
+#include <immintrin.h>
+#endif
+#if defined( _MSC_VER )
+#include <intrin.h>
+#endif
+
 #include <cstddef>
+#include <cstdint>
 #include <cstring>
+#include <type_traits>
 
 namespace daw::json {
 	inline namespace DAW_JSON_VER {
@@ -170,8 +181,9 @@ namespace daw::json {
 				}
 				__m128i b{ };
 				auto const max_pos = last - first;
+				memcpy( &b, first, static_cast<std::size_t>( max_pos ) );
 				int const result =
-				  _mm_cmpestri( a, keys_len::vlaue, b, 16, compare_mode::value );
+				  _mm_cmpestri( a, keys_len::value, b, 16, compare_mode::value );
 				if( result < max_pos ) {
 					return first + result;
 				}
@@ -295,7 +307,8 @@ namespace daw::json {
 					auto const val0 = uload16_char_data( tag, first );
 					UInt32 const backslashes = mem_find_eq<'\\'>( tag, val0 );
 					if( ( backslashes != 0 ) & ( first_escape < 0 ) ) {
-						first_escape = find_lsb_set( tag, backslashes );
+						first_escape =
+						  ( first - first_first ) + find_lsb_set( tag, backslashes );
 					}
 					UInt32 const escaped =
 					  find_escaped_branchless( tag, prev_escapes, backslashes );
@@ -316,7 +329,7 @@ namespace daw::json {
 							return first;
 						}
 						if( first_escape < 0 ) {
-							first_escape = first_first - first;
+							first_escape = first - first_first;
 						}
 						first += 2;
 					}
@@ -333,7 +346,7 @@ namespace daw::json {
 							return first;
 						}
 						if( first_escape < 0 ) {
-							first_escape = first_first - first;
+							first_escape = first - first_first;
 						}
 						first += 2;
 					}
@@ -343,6 +356,134 @@ namespace daw::json {
 			}
 
 #endif
+
+			DAW_ATTRIB_INLINE std::ptrdiff_t ctz64( std::uint64_t value ) {
+#if DAW_HAS_BUILTIN( __builtin_ctzll )
+				return static_cast<std::ptrdiff_t>( __builtin_ctzll( value ) );
+#elif defined( _MSC_VER ) and defined( _M_X64 )
+				unsigned long index;
+				_BitScanForward64( &index, value );
+				return static_cast<std::ptrdiff_t>( index );
+#else
+				std::ptrdiff_t result = 0;
+				while( ( value & 1U ) == 0 ) {
+					value >>= 1U;
+					++result;
+				}
+				return result;
+#endif
+			}
+
+			DAW_ATTRIB_INLINE std::size_t popcount64( std::uint64_t value ) {
+#if DAW_HAS_BUILTIN( __builtin_popcountll )
+				return static_cast<std::size_t>( __builtin_popcountll( value ) );
+#else
+				std::size_t result = 0;
+				while( value != 0 ) {
+					value &= value - 1U;
+					++result;
+				}
+				return result;
+#endif
+			}
+
+			// 64bit version of find_escaped_branchless.  prev_escaped is 1 when the
+			// last character of the previous block was an unescaped backslash
+			DAW_ATTRIB_INLINE constexpr std::uint64_t
+			find_escaped_branchless64( std::uint64_t &prev_escaped,
+			                           std::uint64_t backslashes ) {
+				constexpr std::uint64_t even_bits = 0x5555'5555'5555'5555ULL;
+				backslashes &= ~prev_escaped;
+				std::uint64_t const follow_escape = ( backslashes << 1U ) | prev_escaped;
+				std::uint64_t const odd_seq_start =
+				  backslashes & ~even_bits & ~follow_escape;
+				std::uint64_t const seq_start_on_even_bits = odd_seq_start + backslashes;
+				prev_escaped =
+				  static_cast<std::uint64_t>( seq_start_on_even_bits < odd_seq_start );
+				std::uint64_t const invert_mask = seq_start_on_even_bits << 1U;
+				return ( even_bits ^ invert_mask ) & follow_escape;
+			}
+
+			/// @brief Each bit is the xor of itself and all the bits below it.  With
+			/// a mask of the unescaped quotes this gives a mask of the characters
+			/// inside strings, including the opening quote
+			DAW_ATTRIB_INLINE constexpr std::uint64_t
+			prefix_xor64( std::uint64_t bitmask ) {
+				bitmask ^= bitmask << 1U;
+				bitmask ^= bitmask << 2U;
+				bitmask ^= bitmask << 4U;
+				bitmask ^= bitmask << 8U;
+				bitmask ^= bitmask << 16U;
+				bitmask ^= bitmask << 32U;
+				return bitmask;
+			}
+
+			/// The strings of a 64 byte block.  Bit n is byte n of the block
+			struct string_block_masks {
+				/// Characters that follow an unescaped backslash
+				std::uint64_t escaped;
+				/// Quotes that are not escaped
+				std::uint64_t quotes;
+				/// Characters inside a string, including the opening quote
+				std::uint64_t in_string;
+			};
+
+			/***
+			 * Find the strings in consecutive 64 byte blocks.  Escapes and open
+			 * strings are carried from one block to the next.  Used with
+			 * for_each_block64
+			 */
+			class string_block_scanner {
+				std::uint64_t m_prev_escaped = 0;
+				std::uint64_t m_prev_in_string = 0;
+
+			public:
+				/// @param quotes The quotes in the block
+				/// @param backslashes The backslashes in the block
+				[[nodiscard]] DAW_ATTRIB_INLINE string_block_masks
+				next( std::uint64_t quotes, std::uint64_t backslashes ) {
+					std::uint64_t const escaped =
+					  find_escaped_branchless64( m_prev_escaped, backslashes );
+					quotes &= ~escaped;
+					std::uint64_t const in_string =
+					  prefix_xor64( quotes ) ^ m_prev_in_string;
+					m_prev_in_string = static_cast<std::uint64_t>(
+					  -static_cast<std::int64_t>( in_string >> 63U ) );
+					return string_block_masks{ escaped, quotes, in_string };
+				}
+
+				/// @brief The last block ended inside a string
+				[[nodiscard]] DAW_ATTRIB_INLINE bool ends_in_string( ) const {
+					return m_prev_in_string != 0;
+				}
+			};
+
+			/***
+			 * Call block_fn( block, block_first ) for each 64 byte block of
+			 * [first, last) until it returns true.  block is the 64 bytes to
+			 * classify and block_first is where they start in the document.  The
+			 * last partial block is copied to a buffer padded with whitespace so
+			 * that 64 bytes can always be read from block
+			 * @return true when block_fn returned true
+			 */
+			template<typename CharT, typename BlockFn>
+			DAW_ATTRIB_INLINE bool for_each_block64( CharT *first, CharT *const last,
+			                                         BlockFn &&block_fn ) {
+				while( last - first >= 64 ) {
+					if( block_fn( static_cast<char const *>( first ), first ) ) {
+						return true;
+					}
+					first += 64;
+				}
+				if( first < last ) {
+					char buff[64];
+					std::memset( buff, ' ', sizeof( buff ) );
+					std::memcpy( buff, first, static_cast<std::size_t>( last - first ) );
+					return block_fn( static_cast<char const *>( buff ), first );
+				}
+				return false;
+			}
+
 			template<bool is_unchecked_input, char... keys, typename CharT>
 			DAW_ATTRIB_INLINE CharT *
 			mem_move_to_next_of( runtime_exec_tag, CharT *first, CharT *last ) {
@@ -370,6 +511,62 @@ namespace daw::json {
 				}
 			}
 
+			/***
+			 * Skip the characters 0x01-0x20, which the parse policies treat as
+			 * whitespace, 8 at a time.
+			 * @return The first other character or last
+			 */
+			template<typename CharT>
+			DAW_ATTRIB_INLINE CharT *mem_skip_whitespace( runtime_exec_tag,
+			                                              CharT *first,
+			                                              CharT *const last ) {
+				constexpr std::uint64_t ones = 0x0101'0101'0101'0101ULL;
+				constexpr std::uint64_t highs = 0x8080'8080'8080'8080ULL;
+				while( last - first >= 8 ) {
+					std::uint64_t w;
+					memcpy( &w, first, sizeof( w ) );
+					// Bytes above 0x20 and zero bytes.  Adding 0x5F to the low 7 bits
+					// cannot carry into the next byte
+					std::uint64_t const above_space =
+					  ( ( ( w & ~highs ) + ones * 0x5FU ) | w ) & highs;
+					std::uint64_t const zeros = ( w - ones ) & ~w & highs;
+					if( ( above_space | zeros ) != 0 ) {
+						break;
+					}
+					first += 8;
+				}
+				while( first < last and
+				       ( static_cast<unsigned>( static_cast<unsigned char>( *first ) ) -
+				         1U ) <= 0x1FU ) {
+					++first;
+				}
+				return first;
+			}
+
+#if defined( DAW_ALLOW_SSE42 )
+			template<typename CharT>
+			DAW_ATTRIB_INLINE CharT *mem_skip_whitespace( sse42_exec_tag tag,
+			                                              CharT *first,
+			                                              CharT *const last ) {
+				__m128i const one = _mm_set1_epi8( 1 );
+				__m128i const ws_max = _mm_set1_epi8( 0x1F );
+				while( last - first >= 16 ) {
+					// Whitespace is 0x00-0x1F after subtracting one
+					__m128i const b =
+					  _mm_sub_epi8( uload16_char_data( tag, first ), one );
+					auto const not_ws =
+					  ~static_cast<unsigned>( _mm_movemask_epi8(
+					    _mm_cmpeq_epi8( _mm_min_epu8( b, ws_max ), b ) ) ) &
+					  0xFFFFU;
+					if( not_ws != 0 ) {
+						return first + find_lsb_set( tag, to_uint32( not_ws ) );
+					}
+					first += 16;
+				}
+				return mem_skip_whitespace( runtime_exec_tag{ }, first, last );
+			}
+#endif
+
 			template<bool is_unchecked_input, typename CharT>
 			DAW_ATTRIB_INLINE CharT *mem_skip_string( runtime_exec_tag const &tag,
 			                                          CharT *first,
@@ -465,7 +662,7 @@ namespace daw::json {
 						return first;
 					case '\\':
 						if( first_escape < 0 ) {
-							first_escape = first_first - first;
+							first_escape = first - first_first;
 						}
 						if constexpr( is_unchecked_input ) {
 							++first;
@@ -480,6 +677,278 @@ namespace daw::json {
 				}
 				return first;
 			}
+
+#if defined( DAW_JSON_HAS_RUNTIME_CPU_DISPATCH )
+			struct quote_backslash_masks {
+				std::uint64_t quotes;
+				std::uint64_t backslashes;
+			};
+
+			/***
+			 * The target specific parts of the wide kernels are limited to
+			 * classifying a 64 byte block into bitmasks.  Everything else is shared
+			 * by the AVX2 and AVX512 paths and is compiled for the baseline target
+			 */
+			template<char... keys>
+			DAW_JSON_TARGET_AVX2 inline std::uint64_t
+			mem_find_eq64( avx2_exec_tag, char const *ptr ) {
+				__m256i const lo =
+				  _mm256_loadu_si256( reinterpret_cast<__m256i const *>( ptr ) );
+				__m256i const hi =
+				  _mm256_loadu_si256( reinterpret_cast<__m256i const *>( ptr + 32 ) );
+				__m256i found_lo = _mm256_setzero_si256( );
+				__m256i found_hi = _mm256_setzero_si256( );
+				(void)( ( found_lo = _mm256_or_si256(
+				            found_lo, _mm256_cmpeq_epi8( lo, _mm256_set1_epi8( keys ) ) ),
+				          found_hi = _mm256_or_si256(
+				            found_hi, _mm256_cmpeq_epi8( hi, _mm256_set1_epi8( keys ) ) ) ),
+				        ... );
+				auto const mlo = static_cast<std::uint32_t>(
+				  _mm256_movemask_epi8( found_lo ) );
+				auto const mhi = static_cast<std::uint32_t>(
+				  _mm256_movemask_epi8( found_hi ) );
+				return static_cast<std::uint64_t>( mlo ) |
+				       ( static_cast<std::uint64_t>( mhi ) << 32U );
+			}
+
+			DAW_JSON_TARGET_AVX2 inline quote_backslash_masks
+			find_quotes_and_backslashes64( avx2_exec_tag, char const *ptr ) {
+				__m256i const lo =
+				  _mm256_loadu_si256( reinterpret_cast<__m256i const *>( ptr ) );
+				__m256i const hi =
+				  _mm256_loadu_si256( reinterpret_cast<__m256i const *>( ptr + 32 ) );
+				__m256i const quote = _mm256_set1_epi8( '"' );
+				__m256i const backslash = _mm256_set1_epi8( '\\' );
+				auto const to_mask64 = []( int l, int h ) {
+					return static_cast<std::uint64_t>( static_cast<std::uint32_t>( l ) ) |
+					       ( static_cast<std::uint64_t>( static_cast<std::uint32_t>( h ) )
+					         << 32U );
+				};
+				return quote_backslash_masks{
+				  to_mask64( _mm256_movemask_epi8( _mm256_cmpeq_epi8( lo, quote ) ),
+				             _mm256_movemask_epi8( _mm256_cmpeq_epi8( hi, quote ) ) ),
+				  to_mask64(
+				    _mm256_movemask_epi8( _mm256_cmpeq_epi8( lo, backslash ) ),
+				    _mm256_movemask_epi8( _mm256_cmpeq_epi8( hi, backslash ) ) ) };
+			}
+
+			template<char... keys>
+			DAW_JSON_TARGET_AVX512 inline std::uint64_t
+			mem_find_eq64( avx512_exec_tag, char const *ptr ) {
+				__m512i const block = _mm512_loadu_si512( ptr );
+				return static_cast<std::uint64_t>(
+				  ( _mm512_cmpeq_epi8_mask( block, _mm512_set1_epi8( keys ) ) | ... ) );
+			}
+
+			DAW_JSON_TARGET_AVX512 inline quote_backslash_masks
+			find_quotes_and_backslashes64( avx512_exec_tag, char const *ptr ) {
+				__m512i const block = _mm512_loadu_si512( ptr );
+				return quote_backslash_masks{
+				  static_cast<std::uint64_t>(
+				    _mm512_cmpeq_epi8_mask( block, _mm512_set1_epi8( '"' ) ) ),
+				  static_cast<std::uint64_t>(
+				    _mm512_cmpeq_epi8_mask( block, _mm512_set1_epi8( '\\' ) ) ) };
+			}
+
+			/// The bytes of the 32 byte block that are not in 0x01-0x20
+			DAW_JSON_TARGET_AVX2 inline std::uint32_t
+			find_not_whitespace32( avx2_exec_tag, __m256i b ) {
+				// Whitespace is 0x00-0x1F after subtracting one
+				b = _mm256_sub_epi8( b, _mm256_set1_epi8( 1 ) );
+				__m256i const ws_max = _mm256_set1_epi8( 0x1F );
+				return ~static_cast<std::uint32_t>( _mm256_movemask_epi8(
+				  _mm256_cmpeq_epi8( _mm256_min_epu8( b, ws_max ), b ) ) );
+			}
+
+			DAW_JSON_TARGET_AVX2 inline std::uint64_t
+			find_not_whitespace64( avx2_exec_tag tag, char const *ptr ) {
+				std::uint32_t const lo = find_not_whitespace32(
+				  tag, _mm256_loadu_si256( reinterpret_cast<__m256i const *>( ptr ) ) );
+				std::uint32_t const hi = find_not_whitespace32(
+				  tag,
+				  _mm256_loadu_si256( reinterpret_cast<__m256i const *>( ptr + 32 ) ) );
+				return static_cast<std::uint64_t>( lo ) |
+				       ( static_cast<std::uint64_t>( hi ) << 32U );
+			}
+
+			DAW_JSON_TARGET_AVX512 inline std::uint64_t
+			find_not_whitespace64( avx512_exec_tag, char const *ptr ) {
+				__m512i const block =
+				  _mm512_sub_epi8( _mm512_loadu_si512( ptr ), _mm512_set1_epi8( 1 ) );
+				return static_cast<std::uint64_t>(
+				  _mm512_cmpgt_epu8_mask( block, _mm512_set1_epi8( 0x1F ) ) );
+			}
+
+			template<typename ExecTag>
+			inline constexpr bool is_wide_exec_tag_v =
+			  std::is_base_of_v<avx2_exec_tag, ExecTag>;
+
+			template<bool is_unchecked_input, char... keys, typename CharT,
+			         typename ExecTag,
+			         std::enable_if_t<is_wide_exec_tag_v<ExecTag>, std::nullptr_t> =
+			           nullptr>
+			inline CharT *mem_move_to_next_of( ExecTag tag, CharT *first,
+			                                   CharT *last ) {
+				while( last - first >= 64 ) {
+					std::uint64_t const found = mem_find_eq64<keys...>( tag, first );
+					if( found != 0 ) {
+						return first + ctz64( found );
+					}
+					first += 64;
+				}
+				return mem_move_to_next_of<is_unchecked_input, keys...>(
+				  runtime_exec_tag{ }, first, last );
+			}
+
+			template<typename CharT, typename ExecTag,
+			         std::enable_if_t<is_wide_exec_tag_v<ExecTag>, std::nullptr_t> =
+			           nullptr>
+			inline CharT *mem_skip_whitespace( ExecTag tag, CharT *first,
+			                                   CharT *const last ) {
+				while( last - first >= 64 ) {
+					std::uint64_t const found = find_not_whitespace64( tag, first );
+					if( found != 0 ) {
+						return first + ctz64( found );
+					}
+					first += 64;
+				}
+				return mem_skip_whitespace( runtime_exec_tag{ }, first, last );
+			}
+
+			template<bool is_unchecked_input, bool track_escape, typename ExecTag,
+			         typename CharT>
+			inline CharT *mem_skip_until_end_of_string_wide(
+			  ExecTag tag, CharT *first, CharT *const last,
+			  std::ptrdiff_t &first_escape ) {
+				if constexpr( not is_unchecked_input ) {
+					daw_json_ensure( first < last, ErrorReason::UnexpectedEndOfData );
+				}
+				CharT *result = last;
+				auto scanner = string_block_scanner{ };
+				(void)for_each_block64(
+				  first, last, [&]( char const *block, CharT *block_first ) {
+					  auto const masks = find_quotes_and_backslashes64( tag, block );
+					  std::uint64_t const quotes =
+					    scanner.next( masks.quotes, masks.backslashes ).quotes;
+					  if constexpr( track_escape ) {
+						  // Only the backslashes before the closing quote are part of the
+						  // string.  When there is no quote this keeps all of them
+						  std::uint64_t const backslashes =
+						    masks.backslashes & ( quotes ^ ( quotes - 1U ) );
+						  if( ( backslashes != 0 ) & ( first_escape < 0 ) ) {
+							  first_escape =
+							    ( block_first - first ) + ctz64( backslashes );
+						  }
+					  }
+					  if( quotes != 0 ) {
+						  result = block_first + ctz64( quotes );
+						  return true;
+					  }
+					  return false;
+				  } );
+				return result;
+			}
+
+			template<bool is_unchecked_input, typename CharT, typename ExecTag,
+			         std::enable_if_t<is_wide_exec_tag_v<ExecTag>, std::nullptr_t> =
+			           nullptr>
+			inline CharT *mem_skip_until_end_of_string( ExecTag tag, CharT *first,
+			                                            CharT *const last ) {
+				std::ptrdiff_t first_escape = -1;
+				return mem_skip_until_end_of_string_wide<is_unchecked_input, false>(
+				  tag, first, last, first_escape );
+			}
+
+			template<bool is_unchecked_input, typename CharT, typename ExecTag,
+			         std::enable_if_t<is_wide_exec_tag_v<ExecTag>, std::nullptr_t> =
+			           nullptr>
+			inline CharT *
+			mem_skip_until_end_of_string( ExecTag tag, CharT *first, CharT *const last,
+			                              std::ptrdiff_t &first_escape ) {
+				return mem_skip_until_end_of_string_wide<is_unchecked_input, true>(
+				  tag, first, last, first_escape );
+			}
+#endif
+
+			/***
+			 * best_available_exec_tag dispatches to the widest kernels the host
+			 * supports. These must come after all the overloads they forward to
+			 */
+			template<bool is_unchecked_input, char... keys, typename CharT>
+			inline CharT *mem_move_to_next_of( best_available_exec_tag, CharT *first,
+			                                   CharT *last ) {
+#if defined( DAW_JSON_HAS_RUNTIME_CPU_DISPATCH )
+				switch( best_simd_level( ) ) {
+				case simd_level::avx512:
+					return mem_move_to_next_of<is_unchecked_input, keys...>(
+					  avx512_exec_tag{ }, first, last );
+				case simd_level::avx2:
+					return mem_move_to_next_of<is_unchecked_input, keys...>(
+					  avx2_exec_tag{ }, first, last );
+				case simd_level::none:
+					break;
+				}
+#endif
+				return mem_move_to_next_of<is_unchecked_input, keys...>(
+				  runtime_exec_tag{ }, first, last );
+			}
+
+			template<bool is_unchecked_input, typename CharT>
+			inline CharT *mem_skip_until_end_of_string( best_available_exec_tag,
+			                                            CharT *first,
+			                                            CharT *const last ) {
+#if defined( DAW_JSON_HAS_RUNTIME_CPU_DISPATCH )
+				switch( best_simd_level( ) ) {
+				case simd_level::avx512:
+					return mem_skip_until_end_of_string<is_unchecked_input>(
+					  avx512_exec_tag{ }, first, last );
+				case simd_level::avx2:
+					return mem_skip_until_end_of_string<is_unchecked_input>(
+					  avx2_exec_tag{ }, first, last );
+				case simd_level::none:
+					break;
+				}
+#endif
+				return mem_skip_until_end_of_string<is_unchecked_input>(
+				  runtime_exec_tag{ }, first, last );
+			}
+
+			template<bool is_unchecked_input, typename CharT>
+			inline CharT *
+			mem_skip_until_end_of_string( best_available_exec_tag, CharT *first,
+			                              CharT *const last,
+			                              std::ptrdiff_t &first_escape ) {
+#if defined( DAW_JSON_HAS_RUNTIME_CPU_DISPATCH )
+				switch( best_simd_level( ) ) {
+				case simd_level::avx512:
+					return mem_skip_until_end_of_string<is_unchecked_input>(
+					  avx512_exec_tag{ }, first, last, first_escape );
+				case simd_level::avx2:
+					return mem_skip_until_end_of_string<is_unchecked_input>(
+					  avx2_exec_tag{ }, first, last, first_escape );
+				case simd_level::none:
+					break;
+				}
+#endif
+				return mem_skip_until_end_of_string<is_unchecked_input>(
+				  runtime_exec_tag{ }, first, last, first_escape );
+			}
+
+			template<typename CharT>
+			inline CharT *mem_skip_whitespace( best_available_exec_tag,
+			                                   CharT *first, CharT *const last ) {
+#if defined( DAW_JSON_HAS_RUNTIME_CPU_DISPATCH )
+				switch( best_simd_level( ) ) {
+				case simd_level::avx512:
+					return mem_skip_whitespace( avx512_exec_tag{ }, first, last );
+				case simd_level::avx2:
+					return mem_skip_whitespace( avx2_exec_tag{ }, first, last );
+				case simd_level::none:
+					break;
+				}
+#endif
+				return mem_skip_whitespace( runtime_exec_tag{ }, first, last );
+			}
 		} // namespace json_details
 	} // namespace DAW_JSON_VER
 } // namespace daw::json
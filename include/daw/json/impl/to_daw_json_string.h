@@ -11,6 +11,7 @@
 #include "version.h"
 
 #include "daw_json_assert.h"
+#include "daw_json_escape_scan.h"
 #include "daw_json_parse_iso8601_utils.h"
 #include "daw_json_serialize_options_impl.h"
 #include "daw_json_serialize_policy.h"
@@ -263,6 +264,97 @@ namespace daw::json {
 				}
 				daw_json_error( ErrorReason::InvalidUTFCodepoint );
 			}
+
+			/// Write the code point to a JSON string, escaping it when needed
+			template<bool restrict_high, typename WritableType>
+			static constexpr void write_escaped_code_point( std::uint32_t cp,
+			                                                WritableType &it ) {
+				switch( cp ) {
+				case '"':
+					it.write( "\\\"" );
+					return;
+				case '\\':
+					it.write( "\\\\" );
+					return;
+				case '\b':
+					it.write( "\\b" );
+					return;
+				case '\f':
+					it.write( "\\f" );
+					return;
+				case '\n':
+					it.write( "\\n" );
+					return;
+				case '\r':
+					it.write( "\\r" );
+					return;
+				case '\t':
+					it.write( "\\t" );
+					return;
+				default:
+					break;
+				}
+				if( cp < 0x20U ) {
+					it = output_hex( static_cast<std::uint16_t>( cp ), it );
+					return;
+				}
+				if constexpr( restrict_high ) {
+					if( cp >= 0x7FU and cp <= 0xFFFFU ) {
+						it = output_hex( static_cast<std::uint16_t>( cp ), it );
+						return;
+					}
+					if( cp > 0xFFFFU ) {
+						it = output_hex(
+						  static_cast<std::uint16_t>( 0xD7C0U + ( cp >> 10U ) ), it );
+						it = output_hex(
+						  static_cast<std::uint16_t>( 0xDC00U + ( cp & 0x3FFU ) ), it );
+						return;
+					}
+				}
+				utf32_to_utf8( cp, it );
+			}
+
+			/***
+			 * Escape the characters in [first, last).  The runs of characters that
+			 * can be copied as is are found with find_escape and written with one
+			 * copy_buffer each.  When the output has to be validated as UTF8, the
+			 * high bytes go through the code point loop too
+			 */
+			template<bool restrict_high, typename WritableType>
+			static inline WritableType copy_escaped_buffer( WritableType it,
+			                                                char const *first,
+			                                                char const *const last ) {
+				constexpr bool escape_high =
+				  restrict_high or
+				  ( WritableType::restricted_string_output ==
+				    options::RestrictedStringOutput::ErrorInvalidUTF8 );
+				while( first < last ) {
+					char const *const clean_last =
+					  find_escape<escape_high>( best_available_exec_tag{ }, first, last );
+					if( clean_last != first ) {
+						it.copy_buffer( first, clean_last );
+						first = clean_last;
+						if( first == last ) {
+							break;
+						}
+					}
+					auto cp_it = utf8::unchecked::iterator<char const *>( first );
+					auto const cp = *cp_it++;
+					if( cp_it.base( ) == first ) {
+						// Not a valid unicode cp
+						if constexpr( WritableType::restricted_string_output ==
+						              options::RestrictedStringOutput::ErrorInvalidUTF8 ) {
+							daw_json_error( ErrorReason::InvalidStringHighASCII );
+						} else {
+							cp_it = utf8::unchecked::iterator<char const *>( first + 1 );
+						}
+					}
+					// A truncated code point at the end must not move past it
+					first = cp_it.base( ) < last ? cp_it.base( ) : last;
+					write_escaped_code_point<restrict_high>( cp, it );
+				}
+				return it;
+			}
 		} // namespace json_details
 
 		namespace utils {
@@ -281,6 +373,15 @@ namespace daw::json {
 				  ( WritableType::restricted_string_output ==
 				    options::RestrictedStringOutput::OnlyAllow7bitsStrings );
 				if constexpr( do_escape ) {
+					if constexpr( json_details::is_contiguous_char_range_v<Container> ) {
+#if defined( DAW_IS_CONSTANT_EVALUATED )
+						if( not DAW_IS_CONSTANT_EVALUATED( ) ) {
+							return json_details::copy_escaped_buffer<restrict_high>(
+							  it, std::data( container ),
+							  std::data( container ) + std::size( container ) );
+						}
+#endif
+					}
 					using iter = DAW_TYPEOF( std::begin( container ) );
 					using it_t = utf8::unchecked::iterator<iter>;
 					auto first = it_t( std::begin( container ) );
@@ -298,52 +399,7 @@ namespace daw::json {
 								first = it_t( std::next( first.base( ) ) );
 							}
 						}
-						switch( cp ) {
-						case '"':
-							it.write( "\\\"" );
-							break;
-						case '\\':
-							it.write( "\\\\" );
-							break;
-						case '\b':
-							it.write( "\\b" );
-							break;
-						case '\f':
-							it.write( "\\f" );
-							break;
-						case '\n':
-							it.write( "\\n" );
-							break;
-						case '\r':
-							it.write( "\\r" );
-							break;
-						case '\t':
-							it.write( "\\t" );
-							break;
-						default:
-							if( cp < 0x20U ) {
-								it = json_details::output_hex( static_cast<std::uint16_t>( cp ),
-								                               it );
-								break;
-							}
-							if constexpr( restrict_high ) {
-								if( cp >= 0x7FU and cp <= 0xFFFFU ) {
-									it = json_details::output_hex(
-									  static_cast<std::uint16_t>( cp ), it );
-									break;
-								}
-								if( cp > 0xFFFFU ) {
-									it = json_details::output_hex(
-									  static_cast<std::uint16_t>( 0xD7C0U + ( cp >> 10U ) ), it );
-									it = json_details::output_hex(
-									  static_cast<std::uint16_t>( 0xDC00U + ( cp & 0x3FFU ) ),
-									  it );
-									break;
-								}
-							}
-							json_details::utf32_to_utf8( cp, it );
-							break;
-						}
+						json_details::write_escaped_code_point<restrict_high>( cp, it );
 					}
 				} else {
 					for( auto c : container ) {
@@ -375,53 +431,8 @@ namespace daw::json {
 				if constexpr( do_escape ) {
 					auto chr_it = utf8::unchecked::iterator<char const *>( ptr );
 					while( *chr_it.base( ) != '\0' ) {
-						auto const cp = *chr_it++;
-						switch( cp ) {
-						case '"':
-							it.write( "\\\"" );
-							break;
-						case '\\':
-							it.write( "\\\\" );
-							break;
-						case '\b':
-							it.write( "\\b" );
-							break;
-						case '\f':
-							it.write( "\\f" );
-							break;
-						case '\n':
-							it.write( "\\n" );
-							break;
-						case '\r':
-							it.write( "\\r" );
-							break;
-						case '\t':
-							it.write( "\\t" );
-							break;
-						default:
-							if( cp < 0x20U ) {
-								it = json_details::output_hex( static_cast<std::uint16_t>( cp ),
-								                               it );
-								break;
-							}
-							if constexpr( restrict_high ) {
-								if( cp >= 0x7FU and cp <= 0xFFFFU ) {
-									it = json_details::output_hex(
-									  static_cast<std::uint16_t>( cp ), it );
-									break;
-								}
-								if( cp > 0xFFFFU ) {
-									it = json_details::output_hex(
-									  static_cast<std::uint16_t>( 0xD7C0U + ( cp >> 10U ) ), it );
-									it = output_hex(
-									  static_cast<std::uint16_t>( 0xDC00U + ( cp & 0x3FFU ) ),
-									  it );
-									break;
-								}
-							}
-							json_details::utf32_to_utf8( cp, it );
-							break;
-						}
+						json_details::write_escaped_code_point<restrict_high>( *chr_it++,
+						                                                       it );
 					}
 				} else {
 					while( *ptr != '\0' ) {
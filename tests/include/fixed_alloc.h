@@ -111,6 +111,11 @@ namespace daw {
 		unsigned char *buffer_start;
 		unsigned char *ptr;
 		std::size_t capacity;
+		// Counted like json_arena_stats so that the two can be compared
+		std::size_t allocation_count = 0;
+		std::size_t bytes_allocated = 0;
+		std::size_t live_bytes = 0;
+		std::size_t peak_live_bytes = 0;
 
 		fixed_allocator_impl( std::size_t Size )
 		  : buffer_start( new unsigned char[Size] )
@@ -163,14 +168,45 @@ namespace daw {
 
 			T *r = reinterpret_cast<T *>( m_data->ptr );
 			m_data->ptr += n * sizeof( T );
+			++m_data->allocation_count;
+			m_data->bytes_allocated += n * sizeof( T );
+			m_data->live_bytes += n * sizeof( T );
+			if( m_data->live_bytes > m_data->peak_live_bytes ) {
+				m_data->peak_live_bytes = m_data->live_bytes;
+			}
 			return r;
 		}
 
-		static constexpr void deallocate( void *const, std::size_t ) noexcept {}
+		// The memory is only reused after release( ).  Values allocated before the
+		// last release( ) are not counted in live_bytes
+		void deallocate( T *const, std::size_t n ) noexcept {
+			auto const bytes = n * sizeof( T );
+			m_data->live_bytes =
+			  bytes < m_data->live_bytes ? m_data->live_bytes - bytes : 0;
+		}
 
 		void constexpr release( ) noexcept {
 			assert( m_data->buffer_start and m_data->ptr );
 			m_data->ptr = m_data->buffer_start;
+			m_data->allocation_count = 0;
+			m_data->bytes_allocated = 0;
+			m_data->live_bytes = 0;
+			m_data->peak_live_bytes = 0;
+		}
+
+		/// Number of allocations since the last release( )
+		[[nodiscard]] std::size_t allocation_count( ) const {
+			return m_data->allocation_count;
+		}
+
+		/// Bytes requested since the last release( ), including deallocated ones
+		[[nodiscard]] std::size_t bytes_allocated( ) const {
+			return m_data->bytes_allocated;
+		}
+
+		/// The high water mark of the bytes allocated and not yet deallocated
+		[[nodiscard]] std::size_t peak_live_bytes( ) const {
+			return m_data->peak_live_bytes;
 		}
 
 		[[nodiscard]] constexpr std::size_t used( ) const {
@@ -9,7 +9,12 @@
 #pragma once
 
 #include "defines.h"
+// The *_arena tests are built with DAW_JSON_TEST_ARENA
+#if defined( DAW_JSON_TEST_ARENA )
+#include <daw/json/daw_json_arena.h>
+#else
 #include "fixed_alloc.h"
+#endif
 
 #include <daw/json/daw_json_link.h>
 
@@ -21,37 +26,47 @@
 #include <vector>
 
 namespace daw::geojson {
-	template<typename T>
-	using Vector = std::vector<T, daw::fixed_allocator<T>>;
-
-	struct Property {
-		std::string_view name;
-	}; // Property
-
-	struct Point {
-		double x;
-		double y;
-	};
+	// The arena and fixed_allocator types are in different inline namespaces
+	// so that nativejson_bench_alloc can link both
+#if defined( DAW_JSON_TEST_ARENA )
+	inline namespace arena_types {
+		template<typename T>
+		using Vector = daw::json::json_arena_vector<T>;
+#else
+	inline namespace fixed_types {
+		template<typename T>
+		using Vector = std::vector<T, daw::fixed_allocator<T>>;
+#endif
 
-	struct Polygon {
-		std::string_view type;
-		Vector<Vector<Point>> coordinates;
-
-		Polygon( std::string_view t, Vector<Vector<Point>> &&coords )
-		  : type( t )
-		  , coordinates( std::move( coords ) ) {}
-	}; // Polygon
-
-	struct Feature {
-		std::string_view type;
-		Property properties;
-		Polygon geometry;
-	}; // Feature
-
-	struct FeatureCollection {
-		std::string_view type;
-		Vector<Feature> features;
-	}; // FeatureCollection
+		struct Property {
+			std::string_view name;
+		}; // Property
+
+		struct Point {
+			double x;
+			double y;
+		};
+
+		struct Polygon {
+			std::string_view type;
+			Vector<Vector<Point>> coordinates;
+
+			Polygon( std::string_view t, Vector<Vector<Point>> &&coords )
+			  : type( t )
+			  , coordinates( std::move( coords ) ) {}
+		}; // Polygon
+
+		struct Feature {
+			std::string_view type;
+			Property properties;
+			Polygon geometry;
+		}; // Feature
+
+		struct FeatureCollection {
+			std::string_view type;
+			Vector<Feature> features;
+		}; // FeatureCollection
+	} // inline namespace
 } // namespace daw::geojson
 
 namespace daw::json {
@@ -0,0 +1,77 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+// The *_alloc tests use a fixed_allocator as their AllocType and the *_arena
+// tests, built from the same sources with DAW_JSON_TEST_ARENA, a json_arena
+
+#pragma once
+
+#include "fixed_alloc.h"
+
+#include <daw/json/daw_json_arena.h>
+
+#include <cstddef>
+#include <iostream>
+
+namespace daw {
+	/// The allocator passed to from_json_alloc for an AllocType
+	template<typename T>
+	[[nodiscard]] fixed_allocator<T> const &
+	test_allocator( fixed_allocator<T> const &alloc ) {
+		return alloc;
+	}
+
+	[[nodiscard]] inline json::json_arena_allocator<char>
+	test_allocator( json::json_arena &arena ) {
+		return json::json_arena_allocator<char>( arena );
+	}
+
+	/// The counters shared by both kinds of AllocType
+	struct json_alloc_report {
+		std::size_t allocation_count = 0;
+		std::size_t bytes_allocated = 0;
+		std::size_t peak_live_bytes = 0;
+		/// The memory the allocator holds to serve them.  The fixed_allocator
+		/// never reuses memory before release( ), the arena reuses the last
+		/// allocation
+		std::size_t bytes_reserved = 0;
+	};
+
+	template<typename T>
+	[[nodiscard]] json_alloc_report
+	alloc_report( fixed_allocator<T> const &alloc ) {
+		return { alloc.allocation_count( ), alloc.bytes_allocated( ),
+		         alloc.peak_live_bytes( ), alloc.used( ) };
+	}
+
+	[[nodiscard]] inline json_alloc_report
+	alloc_report( json::json_arena const &arena ) {
+		auto const &stats = arena.stats( );
+		return { stats.allocation_count, stats.bytes_allocated,
+		         stats.peak_live_bytes, stats.bytes_reserved };
+	}
+
+	inline void print_alloc_stats( json_alloc_report const &report ) {
+		std::cout << report.allocation_count << " allocations, "
+		          << report.bytes_allocated << " bytes, "
+		          << report.peak_live_bytes << " bytes peak, "
+		          << report.bytes_reserved << " bytes reserved";
+	}
+
+	template<typename T>
+	void print_alloc_stats( fixed_allocator<T> const &alloc ) {
+		std::cout << "fixed_allocator: ";
+		print_alloc_stats( alloc_report( alloc ) );
+		std::cout << '\n';
+	}
+
+	inline void print_alloc_stats( json::json_arena const &arena ) {
+		std::cout << "json_arena: ";
+		print_alloc_stats( alloc_report( arena ) );
+		std::cout << ", " << arena.stats( ).block_count << " blocks\n";
+	}
+} // namespace daw
@@ -0,0 +1,29 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#pragma once
+
+#include "json_test_alloc.h"
+
+#include <string_view>
+
+namespace daw {
+	/// The allocations made while parsing each nativejson document once
+	struct nativejson_alloc_reports {
+		json_alloc_report twitter;
+		json_alloc_report citm;
+		json_alloc_report canada;
+	};
+
+	/// Parse the documents with a json_arena.  It is defined in
+	/// nativejson_alloc_report.cpp, which is built with DAW_JSON_TEST_ARENA so
+	/// that nativejson_bench_alloc can compare it with the fixed_allocator
+	[[nodiscard]] nativejson_alloc_reports
+	arena_alloc_reports( std::string_view twitter_json, std::string_view citm_json,
+	                     std::string_view canada_json );
+} // namespace daw
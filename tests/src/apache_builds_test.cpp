@@ -85,6 +85,25 @@ void test( std::string_view json_sv1 ) {
 
 	test_assert( not str.empty( ), "Expected a string value" );
 
+	// The same document minified and pretty printed.  The difference is the
+	// cost of skipping whitespace
+	auto const pretty = daw::json::to_json(
+	  apache_builds_result,
+	  daw::json::options::output_flags<
+	    daw::json::options::SerializationFormat::Pretty> );
+	auto const bench_parse = []( char const *title, std::string_view doc ) {
+		(void)daw::bench_n_test_mbs<DAW_NUM_RUNS>(
+		  title, doc.size( ),
+		  []( auto f1 ) {
+			  auto r =
+			    daw::json::from_json<apache_builds::apache_builds>( f1, ParsePolicy );
+			  daw::do_not_optimize( r );
+		  },
+		  doc );
+	};
+	bench_parse( "apache_builds bench(minified)", str );
+	bench_parse( "apache_builds bench(pretty)", pretty );
+
 	daw::do_not_optimize( str );
 	auto const apache_builds_result2 =
 	  daw::json::from_json<apache_builds::apache_builds>( str, ParsePolicy );
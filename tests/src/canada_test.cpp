@@ -140,6 +140,20 @@ int main( int argc, char **argv )
 	                                 daw::json::runtime_exec_tag> ) {
 		test<daw::json::options::ExecModeTypes::simd>( json_data1, do_asserts );
 	}
+	{
+		std::optional<daw::geojson::FeatureCollection> canada_result;
+		(void)daw::bench_n_test_mbs<DAW_NUM_RUNS>(
+		  "canada bench(precise)", sz,
+		  [&]( auto f1 ) {
+			  canada_result = from_json<daw::geojson::FeatureCollection>(
+			    f1, options::parse_flags<options::IEEE754Precise::yes> );
+			  daw::do_not_optimize( canada_result );
+		  },
+		  std::string_view( json_data1 ) );
+		if( do_asserts ) {
+			test_assert( canada_result, "Missing value" );
+		}
+	}
 
 	std::cout
 	  << "to_json testing\n*********************************************\n";
@@ -174,6 +188,26 @@ int main( int argc, char **argv )
 		  canada_result );
 		daw::do_not_optimize( str );
 	}
+	{
+		// The same document minified and pretty printed.  The difference is the
+		// cost of skipping whitespace
+		auto const minified = daw::json::to_json( canada_result );
+		auto const pretty = daw::json::to_json(
+		  canada_result, daw::json::options::output_flags<
+		                   daw::json::options::SerializationFormat::Pretty> );
+		auto const bench_parse = []( char const *title, std::string_view doc ) {
+			(void)daw::bench_n_test_mbs<DAW_NUM_RUNS>(
+			  title, doc.size( ),
+			  []( auto f1 ) {
+				  auto r = get_canada_check<
+				    daw::json::options::ExecModeTypes::best_available>( f1 );
+				  daw::do_not_optimize( r );
+			  },
+			  doc );
+		};
+		bench_parse( "canada bench(minified)", minified );
+		bench_parse( "canada bench(pretty)", pretty );
+	}
 
 	// Removing for now as it will do a float compare and fail
 	/*
@@ -13,6 +13,7 @@
 #include "defines.h"
 
 #include "geojson_alloc.h"
+#include "json_test_alloc.h"
 
 #include "daw/json/daw_json_link.h"
 
@@ -48,7 +49,11 @@ DAW_CONSTEXPR bool operator==( T const &lhs, T const &rhs ) {
 	return true;
 }
 
+#if defined( DAW_JSON_TEST_ARENA )
+using AllocType = daw::json::json_arena;
+#else
 using AllocType = daw::fixed_allocator<char>;
+#endif
 using namespace daw::json::options;
 template<ExecModeTypes ExecMode>
 void test( std::string_view json_sv1, AllocType &alloc ) {
@@ -64,11 +69,12 @@ void test( std::string_view json_sv1, AllocType &alloc ) {
 		  canada_result.reset( );
 		  alloc.release( );
 		  canada_result = daw::json::from_json_alloc<daw::geojson::Polygon>(
-		    f1, "features[0].geometry", alloc, parse_flags<ExecMode> );
+		    f1, "features[0].geometry", daw::test_allocator( alloc ),
+		    parse_flags<ExecMode> );
 		  daw::do_not_optimize( canada_result );
 	  },
 	  json_sv1 );
-	std::cout << "Total Allocations: " << alloc.used( ) << " bytes\n";
+	daw::print_alloc_stats( alloc );
 	daw::do_not_optimize( canada_result );
 	test_assert( canada_result, "Missing value" );
 	//**************************
@@ -78,7 +84,7 @@ void test( std::string_view json_sv1, AllocType &alloc ) {
 		  canada_result.reset( );
 		  alloc.release( );
 		  canada_result = daw::json::from_json_alloc<daw::geojson::Polygon>(
-		    f1, "features[0].geometry", alloc,
+		    f1, "features[0].geometry", daw::test_allocator( alloc ),
 		    parse_flags<ExecMode, CheckedParseMode::no> );
 		  daw::do_not_optimize( canada_result );
 	  },
@@ -119,7 +125,7 @@ int main( int argc, char **argv )
 	std::cout
 	  << "to_json testing\n*********************************************\n";
 	auto const canada_result = daw::json::from_json_alloc<daw::geojson::Polygon>(
-	  json_sv1, "features[0].geometry", alloc );
+	  json_sv1, "features[0].geometry", daw::test_allocator( alloc ) );
 	std::string str{ };
 	{
 		str.reserve( json_sv1.size( ) );
@@ -135,7 +141,8 @@ int main( int argc, char **argv )
 	test_assert( not str.empty( ), "Expected a string value" );
 	daw::do_not_optimize( str );
 	auto const canada_result2 =
-	  daw::json::from_json_alloc<daw::geojson::Polygon>( str, alloc );
+	  daw::json::from_json_alloc<daw::geojson::Polygon>(
+	    str, daw::test_allocator( alloc ) );
 	daw::do_not_optimize( canada_result2 );
 	{
 		auto const str_sz = str.size( );
@@ -74,6 +74,25 @@ void test( std::string_view json_sv1, bool do_asserts ) {
 			             "Incorrect value" );
 		}
 	}
+	{
+		auto citm_result2 = daw::bench_n_test_mbs<DAW_NUM_RUNS>(
+		  "citm_catalog bench(checked, length_and_bytes names)", sz,
+		  []( auto f1 ) {
+			  return daw::json::from_json<daw::citm::citm_object_t>(
+			    f1,
+			    parse_flags<ExecMode, MemberNameMatching::length_and_bytes> );
+		  },
+		  json_sv1 );
+		daw::do_not_optimize( citm_result2 );
+		if( do_asserts ) {
+			test_assert( citm_result2, "Missing value" );
+			test_assert( not citm_result2->areaNames.empty( ), "Expected values" );
+			test_assert( citm_result2->areaNames.count( 205706005 ) == 1,
+			             "Expected value" );
+			test_assert( citm_result2->areaNames[205706005] == "1er balcon jardin",
+			             "Incorrect value" );
+		}
+	}
 }
 
 int main( int argc, char **argv )
@@ -126,6 +145,23 @@ int main( int argc, char **argv )
 	  citm_result );
 	test_assert( not str.empty( ), "Expected a string value" );
 	daw::do_not_optimize( str );
+
+	// The same document minified and pretty printed.  The difference is the
+	// cost of skipping whitespace
+	auto const pretty = daw::json::to_json(
+	  citm_result, output_flags<SerializationFormat::Pretty> );
+	auto const bench_parse = []( char const *title, std::string_view doc ) {
+		(void)daw::bench_n_test_mbs<DAW_NUM_RUNS>(
+		  title, doc.size( ),
+		  []( auto f1 ) {
+			  auto r = daw::json::from_json<daw::citm::citm_object_t>(
+			    f1, parse_flags<ExecModeTypes::best_available> );
+			  daw::do_not_optimize( r );
+		  },
+		  doc );
+	};
+	bench_parse( "citm bench(minified)", str );
+	bench_parse( "citm bench(pretty)", pretty );
 }
 #if defined( DAW_USE_EXCEPTIONS )
 catch( daw::json::json_exception const &jex ) {
@@ -13,6 +13,7 @@
 #include "defines.h"
 
 #include "citm_test_json_alloc.h"
+#include "json_test_alloc.h"
 
 #include <daw/daw_benchmark.h>
 #include <daw/daw_read_file.h>
@@ -32,7 +33,11 @@ static inline constexpr std::size_t DAW_NUM_RUNS = 2;
 #endif
 static_assert( DAW_NUM_RUNS > 0 );
 
+#if defined( DAW_JSON_TEST_ARENA )
+using AllocType = daw::json::json_arena;
+#else
 using AllocType = daw::fixed_allocator<daw::citm::citm_object_t>;
+#endif
 
 using namespace daw::json::options;
 
@@ -46,10 +51,10 @@ void test( std::string_view json_sv1, AllocType &alloc ) {
 		  "citm_catalog bench(checked)", sz,
 		  [&]( auto f1 ) {
 			  return daw::json::from_json_alloc<daw::citm::citm_object_t>(
-			    f1, alloc, parse_flags<ExecMode> );
+			    f1, daw::test_allocator( alloc ), parse_flags<ExecMode> );
 		  },
 		  json_sv1 );
-		std::cout << "Total Allocations: " << alloc.used( ) << " bytes\n";
+		daw::print_alloc_stats( alloc );
 		daw::do_not_optimize( citm_result2 );
 		test_assert( citm_result2, "Missing value" );
 		test_assert( not citm_result2->areaNames.empty( ), "Expected values" );
@@ -64,10 +69,11 @@ void test( std::string_view json_sv1, AllocType &alloc ) {
 		  "citm_catalog bench(unchecked)", sz,
 		  [&]( auto f1 ) {
 			  return daw::json::from_json_alloc<daw::citm::citm_object_t>(
-			    f1, alloc, parse_flags<ExecMode, CheckedParseMode::no> );
+			    f1, daw::test_allocator( alloc ),
+			    parse_flags<ExecMode, CheckedParseMode::no> );
 		  },
 		  json_sv1 );
-		std::cout << "Total Allocations: " << alloc.used( ) << " bytes\n";
+		daw::print_alloc_stats( alloc );
 		daw::do_not_optimize( citm_result2 );
 		test_assert( citm_result2, "Missing value" );
 		test_assert( not citm_result2->areaNames.empty( ), "Expected values" );
@@ -108,9 +114,10 @@ int main( int argc, char **argv )
 	std::cout
 	  << "to_json testing\n*********************************************\n";
 	auto const citm_result =
-	  daw::json::from_json_alloc<daw::citm::citm_object_t>( json_sv1, alloc );
+	  daw::json::from_json_alloc<daw::citm::citm_object_t>(
+	    json_sv1, daw::test_allocator( alloc ) );
 
-	std::cout << "Total Allocations: " << alloc.used( ) << " bytes\n";
+	daw::print_alloc_stats( alloc );
 	// Should be 522'960 bytes
 	std::string str{ };
 	str.reserve( json_sv1.size( ) );
@@ -0,0 +1,103 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+// Serialize strings with characters that need escaping at every position
+// around the 64 byte blocks of the escape scanner and compare them to a
+// simple escaper
+
+#include "defines.h"
+
+#include <daw/json/daw_json_link.h>
+
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include <string_view>
+
+namespace tests {
+	std::string escape_reference( std::string_view str ) {
+		constexpr char const hex[] = "0123456789ABCDEF";
+		auto result = std::string( "\"" );
+		for( char c : str ) {
+			auto const u = static_cast<unsigned char>( c );
+			switch( c ) {
+			case '"':
+				result += "\\\"";
+				break;
+			case '\\':
+				result += "\\\\";
+				break;
+			case '\b':
+				result += "\\b";
+				break;
+			case '\f':
+				result += "\\f";
+				break;
+			case '\n':
+				result += "\\n";
+				break;
+			case '\r':
+				result += "\\r";
+				break;
+			case '\t':
+				result += "\\t";
+				break;
+			default:
+				if( u < 0x20U ) {
+					result += "\\u00";
+					result += hex[u >> 4U];
+					result += hex[u & 0xFU];
+				} else {
+					result += c;
+				}
+				break;
+			}
+		}
+		result += '"';
+		return result;
+	}
+} // namespace tests
+
+int main( int, char ** )
+#if defined( DAW_USE_EXCEPTIONS )
+  try
+#endif
+{
+	using namespace daw::json;
+	constexpr std::string_view specials[] = { "\"", "\\", "\n", "\t", "\x01",
+	                                          "\x1F", "\xC3\xA9" };
+	for( auto special : specials ) {
+		for( std::size_t pos = 0; pos < 140; ++pos ) {
+			auto str = std::string( 140, 'a' );
+			str.replace( pos, 1, special );
+			auto const json_doc = to_json( str );
+			test_assert( json_doc == tests::escape_reference( str ),
+			             "Unexpected escaping" );
+			test_assert( from_json<std::string>( json_doc ) == str,
+			             "Escaped string does not round trip" );
+		}
+	}
+
+	// Restricting the output to 7 bits escapes the code points from DEL up
+	using options::RestrictedStringOutput;
+	constexpr auto seven_bits =
+	  options::output_flags<RestrictedStringOutput::OnlyAllow7bitsStrings>;
+	auto const padding = std::string( 70, 'b' );
+	auto const restricted =
+	  to_json( padding + "\x7F\xC3\xA9\xF0\x9F\x98\x80" + padding, seven_bits );
+	test_assert( restricted == "\"" + padding + "\\u007F\\u00E9\\uD83D\\uDE00" +
+	                             padding + "\"",
+	             "Unexpected escaping of high code points" );
+
+	std::cout << "done\n";
+}
+#if defined( DAW_USE_EXCEPTIONS )
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+}
+#endif
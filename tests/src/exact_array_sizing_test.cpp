@@ -0,0 +1,124 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+// Parse arrays with options::ExactArraySizing and check that the vectors are
+// allocated with the element count of the array.  The element counter works
+// on 64 byte blocks, so strings, escapes and nested arrays are moved across
+// the block boundaries
+
+#include "defines.h"
+
+#include <daw/json/daw_json_link.h>
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+struct Names {
+	int id{ };
+	std::vector<std::string> names{ };
+};
+
+namespace daw::json {
+	template<>
+	struct json_data_contract<Names> {
+#if defined( DAW_JSON_CNTTP_JSON_NAME )
+		using type = json_member_list<json_number<"id", int>,
+		                              json_array<"names", std::string>>;
+#else
+		static constexpr char const id[] = "id";
+		static constexpr char const names[] = "names";
+		using type = json_member_list<json_number<id, int>,
+		                              json_array<names, std::string>>;
+#endif
+	};
+} // namespace daw::json
+
+template<daw::json::options::ExecModeTypes ExecMode>
+void check_known_bounds( std::string const &json_doc,
+                         std::size_t expected_size ) {
+	using namespace daw::json;
+	auto const result = from_json<Names>(
+	  json_doc,
+	  options::parse_flags<options::ExactArraySizing::yes, ExecMode> );
+	test_assert( result.names.size( ) == expected_size and
+	               result.names.capacity( ) == expected_size,
+	             "Expected the array to be sized exactly" );
+}
+
+template<typename T, daw::json::options::ExecModeTypes ExecMode>
+void check_exact( std::string const &json_doc ) {
+	using namespace daw::json;
+	auto const expected = from_json<std::vector<T>>( json_doc );
+	auto const result = from_json<std::vector<T>>(
+	  json_doc,
+	  options::parse_flags<options::ExactArraySizing::yes, ExecMode> );
+	test_assert( result == expected, "Result differs from the default parse" );
+	test_assert( result.capacity( ) == expected.size( ),
+	             "Expected the array to be sized exactly" );
+}
+
+template<typename T>
+void check_exact( std::string const &json_doc ) {
+	using daw::json::options::ExecModeTypes;
+	check_exact<T, ExecModeTypes::compile_time>( json_doc );
+	check_exact<T, ExecModeTypes::runtime>( json_doc );
+	check_exact<T, ExecModeTypes::best_available>( json_doc );
+}
+
+int main( int, char ** )
+#if defined( DAW_USE_EXCEPTIONS )
+  try
+#endif
+{
+	using namespace daw::json;
+	check_exact<int>( "[1]" );
+	check_exact<int>( " [ 1 , 2 ] " );
+	check_exact<std::vector<int>>( "[[]]" );
+	check_exact<std::vector<int>>( "[[],[ ],[1,2]]" );
+	check_exact<std::string>( R"(["a,b","[","]","{,}"])" );
+	// An escaped backslash does not escape the closing quote
+	check_exact<std::string>( R"(["\\",",","\\\"]","\"\\"])" );
+
+	for( std::size_t pad = 0; pad < 130; ++pad ) {
+		auto const ws = std::string( pad, ' ' );
+		// Commas and brackets in strings, with escapes on either side of the
+		// block boundaries
+		check_exact<std::string>( "[" + ws + R"("a\",b","\\\\",)" + ws +
+		                          R"("[{,","\\\"]")" + ws + "]" );
+		// Runs of backslashes that end at and across the block boundaries
+		check_exact<std::string>( "[\"" + ws + std::string( 64, '\\' ) +
+		                          "\",\"" + std::string( 63, '\\' ) + "\\,\"]" );
+		// A string longer than a block
+		check_exact<std::string>( "[\"" + std::string( 70 + pad, ',' ) +
+		                          "\",\"]\"]" );
+		// Nested arrays that close in the next block
+		check_exact<std::vector<int>>( "[" + ws + "[1," + ws + "2],[" + ws +
+		                               "],[3]" + ws + "]" );
+	}
+
+	// names is skipped while looking for id, so its bounds are known when it is
+	// parsed and the comma count of that skip is used
+	check_known_bounds<options::ExecModeTypes::compile_time>(
+	  R"({"names":["a,b","]",""],"id":1})", 3 );
+	check_known_bounds<options::ExecModeTypes::runtime>(
+	  R"({"names":[ "a" ],"id":1})", 1 );
+	check_known_bounds<options::ExecModeTypes::best_available>(
+	  R"({"names":[ ],"id":1})", 0 );
+
+	auto const empty = from_json<std::vector<int>>(
+	  " [ ] ", options::parse_flags<options::ExactArraySizing::yes> );
+	test_assert( empty.empty( ) and empty.capacity( ) == 0,
+	             "Expected no allocation for an empty array" );
+	std::cout << "done\n";
+}
+#if defined( DAW_USE_EXCEPTIONS )
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+}
+#endif
@@ -0,0 +1,102 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+// Parse strings with options::ExcludeSpecialEscapes in each exec mode.  Valid
+// escapes are accepted and control characters or unknown escapes are rejected
+// wherever they are in the string
+
+#include "defines.h"
+
+#include <daw/json/daw_json_link.h>
+
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#if defined( DAW_USE_EXCEPTIONS )
+template<daw::json::options::ExecModeTypes ExecMode>
+daw::json::ErrorReason zero_terminated_error( std::string const &json_doc ) {
+	using namespace daw::json;
+	try {
+		(void)from_json<std::string>(
+		  json_doc,
+		  options::parse_flags<options::ExcludeSpecialEscapes::yes,
+		                       options::ZeroTerminatedString::yes, ExecMode> );
+	} catch( json_exception const &jex ) { return jex.reason_type( ); }
+	return daw::json::ErrorReason::Unknown;
+}
+#endif
+
+template<daw::json::options::ExecModeTypes ExecMode>
+void test_strict_strings( ) {
+	using namespace daw::json;
+	static constexpr auto flags =
+	  options::parse_flags<options::ExcludeSpecialEscapes::yes, ExecMode>;
+
+	std::string const valid =
+	  R"(["plain", "a \"quoted\" \\ \/ \b\f\n\r\t é string", ""])";
+	auto const values = from_json<std::vector<std::string>>( valid, flags );
+	test_assert( values.size( ) == 3 and values[0] == "plain" and
+	               values[1] == "a \"quoted\" \\ / \b\f\n\r\t \xC3\xA9 string" and
+	               values[2].empty( ),
+	             "Unexpected strings" );
+
+	// Move the bad character across the 64 byte blocks of the scanner
+	for( std::size_t pos = 0; pos < 140; ++pos ) {
+		auto str = std::string( 140, 'a' );
+		str.replace( pos, 1, "\\n" );
+		auto const doc = "\"" + str + "\"";
+		auto const expected =
+		  std::string( pos, 'a' ) + "\n" + std::string( 139 - pos, 'a' );
+		test_assert( from_json<std::string>( doc, flags ) == expected,
+		             "Unexpected escaped string" );
+#if defined( DAW_USE_EXCEPTIONS )
+		for( char const *bad : { "\t", "\x01", "\\x", "\\a" } ) {
+			auto bad_str = std::string( 140, 'a' );
+			bad_str.replace( pos, 1, bad );
+			bool has_error = false;
+			try {
+				(void)from_json<std::string>( "\"" + bad_str + "\"", flags );
+			} catch( json_exception const & ) { has_error = true; }
+			test_assert( has_error, "Expected an invalid string error" );
+		}
+#endif
+	}
+
+#if defined( DAW_USE_EXCEPTIONS )
+	// The NUL that terminates the buffer ends the data, one inside the string
+	// is a control character
+	test_assert( zero_terminated_error<ExecMode>( "\"abc" ) ==
+	               ErrorReason::UnexpectedEndOfData,
+	             "Expected an end of data error" );
+	test_assert( zero_terminated_error<ExecMode>( "\"abc\\" ) ==
+	               ErrorReason::UnexpectedEndOfData,
+	             "Expected an end of data error" );
+	test_assert( zero_terminated_error<ExecMode>(
+	               std::string( "\"a\0bc\"", 6 ) ) == ErrorReason::InvalidString,
+	             "Expected an invalid string error" );
+#endif
+}
+
+int main( int, char ** )
+#if defined( DAW_USE_EXCEPTIONS )
+  try
+#endif
+{
+	using daw::json::options::ExecModeTypes;
+	test_strict_strings<ExecModeTypes::compile_time>( );
+	test_strict_strings<ExecModeTypes::runtime>( );
+	test_strict_strings<ExecModeTypes::best_available>( );
+	std::cout << "done\n";
+}
+#if defined( DAW_USE_EXCEPTIONS )
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+}
+#endif
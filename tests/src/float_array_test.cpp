@@ -38,6 +38,11 @@ struct Number2 {
 	float a{ };
 };
 
+struct Numbers {
+	int id{ };
+	std::vector<float> values{ };
+};
+
 namespace daw::json {
 	template<>
 	struct json_data_contract<Number> {
@@ -56,6 +61,19 @@ namespace daw::json {
 #else
 		static constexpr char const a[] = "a";
 		using type = json_member_list<json_number<a, float>>;
+#endif
+	};
+
+	template<>
+	struct json_data_contract<Numbers> {
+#if defined( DAW_JSON_CNTTP_JSON_NAME )
+		using type = json_member_list<json_number<"id", int>,
+		                              json_array<"values", float>>;
+#else
+		static constexpr char const id[] = "id";
+		static constexpr char const values[] = "values";
+		using type =
+		  json_member_list<json_number<id, int>, json_array<values, float>>;
 #endif
 	};
 } // namespace daw::json
@@ -174,6 +192,65 @@ void test_func( ) {
 		std::cout << "element count 2: " << count2 << '\n';
 	}
 
+	{ // just floats, counted before parsing
+		auto json_sv = std::string_view( json_data2 );
+		auto const count = *daw::bench_n_test_mbs<DAW_NUM_RUNS>(
+		  "p2. float parsing exact sizing", json_sv.size( ),
+		  []( auto &&sv ) noexcept {
+			  auto const data = from_json_array<float>(
+			    sv, parse_flags<ExactArraySizing::yes> );
+			  daw::do_not_optimize( data );
+			  return data.size( );
+		  },
+		  json_sv );
+		std::cout << "element count: " << count << '\n';
+
+		auto const count2 = *daw::bench_n_test_mbs<DAW_NUM_RUNS>(
+		  "p2. float parsing exact sizing best_available", json_sv.size( ),
+		  []( auto &&sv ) noexcept {
+			  auto const data = from_json_array<float>(
+			    sv, parse_flags<ExactArraySizing::yes,
+			                    ExecModeTypes::best_available> );
+			  daw::do_not_optimize( data );
+			  return data.size( );
+		  },
+		  json_sv );
+		std::cout << "element count: " << count2 << '\n';
+
+		auto const exact = from_json_array<float>(
+		  json_sv,
+		  parse_flags<ExactArraySizing::yes, ExecModeTypes::best_available> );
+		test_assert( exact.size( ) == NUMVALUES and
+		               exact.capacity( ) == exact.size( ),
+		             "Expected the vector to be sized exactly" );
+		test_assert( exact == from_json_array<float>( json_sv ),
+		             "Exact sizing changed the result" );
+	}
+	{ // Whitespace around the elements of a number array
+		auto const expected = std::vector<float>{ 1.5f, -2.0f, 3.25f };
+		test_assert( from_json_array<float>( "[ 1.5 ,-2.0\n,\t3.25 ]" ) ==
+		               expected,
+		             "Unexpected number array" );
+		test_assert( from_json_array<float>( "[1.5,-2.0,3.25]" ) == expected,
+		             "Unexpected number array" );
+		test_assert( from_json_array<float>( "[ ]" ).empty( ),
+		             "Expected an empty number array" );
+	}
+	{ // A number array that is skipped before it is parsed is sized with the
+	  // element count found by the skip
+		auto const numbers =
+		  from_json<Numbers>( R"({"values":[ 1.5, 2, 3.25 ,4 ],"id":1})" );
+		test_assert( numbers.values.size( ) == 4 and
+		               numbers.values.capacity( ) == 4,
+		             "Expected the vector to be sized exactly" );
+		auto const one = from_json<Numbers>( R"({"values":[1.5],"id":1})" );
+		test_assert( one.values.size( ) == 1 and one.values.capacity( ) == 1,
+		             "Expected the vector to be sized exactly" );
+		auto const empty = from_json<Numbers>( R"({"values":[ ],"id":1})" );
+		test_assert( empty.values.empty( ) and empty.values.capacity( ) == 0,
+		             "Expected no allocation for an empty array" );
+	}
+
 	std::cout << "Checked\n";
 	{ // Class of ints
 		auto json_sv = std::string_view( json_data );
@@ -0,0 +1,149 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+// Parse documents into existing values with from_json_into and check that the
+// storage of the strings and vectors is reused
+
+#include "defines.h"
+
+#include <daw/json/daw_json_link.h>
+
+#include <iostream>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <vector>
+
+namespace tests {
+	struct point_t {
+		double x;
+		double y;
+	};
+
+	struct message_t {
+		std::string text;
+		std::vector<std::string> tags;
+		std::vector<point_t> points;
+		std::optional<std::string> note;
+	};
+} // namespace tests
+
+namespace daw::json {
+	template<>
+	struct json_data_contract<tests::point_t> {
+		static constexpr char const x[] = "x";
+		static constexpr char const y[] = "y";
+		using type = json_member_list<json_number<x>, json_number<y>>;
+
+		static constexpr auto to_json_data( tests::point_t const &p ) {
+			return std::forward_as_tuple( p.x, p.y );
+		}
+	};
+
+	template<>
+	struct json_data_contract<tests::message_t> {
+		static constexpr char const text[] = "text";
+		static constexpr char const tags[] = "tags";
+		static constexpr char const points[] = "points";
+		static constexpr char const note[] = "note";
+		using type = json_member_list<
+		  json_string<text>, json_array<tags, std::string>,
+		  json_array<points, tests::point_t>, json_string_null<note>>;
+
+		static constexpr auto to_json_data( tests::message_t const &m ) {
+			return std::forward_as_tuple( m.text, m.tags, m.points, m.note );
+		}
+	};
+} // namespace daw::json
+
+int main( int, char ** )
+#if defined( DAW_USE_EXCEPTIONS )
+  try
+#endif
+{
+	using namespace daw::json;
+	static_assert( json_details::can_parse_class_into_v<
+	                 json_details::json_deduced_type<tests::message_t>> );
+
+	std::string_view const first_doc =
+	  R"({"text":"the first message, too long for the small string buffer",)"
+	  R"("tags":["a tag that is too long for the small string buffer","b"],)"
+	  R"("points":[{"x":1,"y":2},{"x":3,"y":4},{"x":5,"y":6}],)"
+	  R"("note":"a note that is too long for the small string buffer"})";
+	std::string_view const second_doc =
+	  R"({"points":[{"y":8,"x":7}],"tags":["c\td"],"text":"short",)"
+	  R"("unknown":[1,2,3]})";
+
+	auto msg = tests::message_t{ };
+	from_json_into( msg, first_doc );
+	test_assert( msg.text ==
+	               "the first message, too long for the small string buffer",
+	             "Unexpected text" );
+	test_assert( msg.tags.size( ) == 2 and msg.tags[1] == "b",
+	             "Unexpected tags" );
+	test_assert( msg.points.size( ) == 3 and msg.points[2].x == 5.0 and
+	               msg.points[2].y == 6.0,
+	             "Unexpected points" );
+	test_assert( msg.note and
+	               *msg.note ==
+	                 "a note that is too long for the small string buffer",
+	             "Unexpected note" );
+
+	auto const text_data = msg.text.data( );
+	auto const tag_data = msg.tags[0].data( );
+	auto const tags_data = msg.tags.data( );
+	auto const points_capacity = msg.points.capacity( );
+	auto const points_data = msg.points.data( );
+
+	from_json_into( msg, second_doc );
+	test_assert( msg.text == "short", "Unexpected text" );
+	test_assert( msg.tags.size( ) == 1 and msg.tags[0] == "c\td",
+	             "Unexpected tags" );
+	test_assert( msg.points.size( ) == 1 and msg.points[0].x == 7.0 and
+	               msg.points[0].y == 8.0,
+	             "Unexpected points" );
+	test_assert( not msg.note, "A missing nullable member should be reset" );
+
+	test_assert( msg.text.data( ) == text_data, "text storage was not reused" );
+	test_assert( msg.tags.data( ) == tags_data, "tags storage was not reused" );
+	test_assert( msg.tags[0].data( ) == tag_data,
+	             "tag element storage was not reused" );
+	test_assert( msg.points.data( ) == points_data and
+	               msg.points.capacity( ) == points_capacity,
+	             "points storage was not reused" );
+
+	// Parsing into a value gives the same result as from_json
+	from_json_into( msg, first_doc );
+	auto const expected = from_json<tests::message_t>( first_doc );
+	test_assert( msg.text == expected.text and msg.tags == expected.tags and
+	               msg.points.size( ) == expected.points.size( ) and
+	               msg.note == expected.note,
+	             "from_json_into and from_json disagree" );
+
+	auto values = std::vector<int>{ 1, 2, 3, 4, 5, 6, 7, 8 };
+	auto const values_data = values.data( );
+	from_json_into( values, std::string_view( "[9, 10]" ) );
+	test_assert( values == std::vector<int>{ 9, 10 }, "Unexpected values" );
+	test_assert( values.data( ) == values_data and values.capacity( ) >= 8,
+	             "values storage was not reused" );
+
+	std::string mutable_doc =
+	  R"({"text":"escaped\nvalue","tags":[],"points":[]})";
+	from_json_into( msg, mutable_doc,
+	                options::parse_flags<options::UnescapeInPlace::yes> );
+	test_assert( msg.text == "escaped\nvalue" and msg.tags.empty( ) and
+	               msg.points.empty( ) and not msg.note,
+	             "Unexpected result with UnescapeInPlace" );
+	std::cout << "done\n";
+}
+#if defined( DAW_USE_EXCEPTIONS )
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+}
+#endif
@@ -155,6 +155,7 @@ int main( int argc, char **argv )
 	                                 daw::json::runtime_exec_tag> ) {
 		test<options::ExecModeTypes::simd>( json_str, json_str_escaped );
 	}
+	test<options::ExecModeTypes::best_available>( json_str, json_str_escaped );
 }
 #if defined( DAW_USE_EXCEPTIONS )
 catch( daw::json::json_exception const &jex ) {
@@ -0,0 +1,114 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+// Parse numbers with options::IEEE754Precise and check that every value is
+// the same as strtod/strtof, with known and unknown bounds
+
+#include "defines.h"
+
+#include <daw/json/daw_json_link.h>
+
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <string>
+#include <string_view>
+
+template<typename Real>
+Real parse_with_libc( char const *str ) {
+	if constexpr( std::is_same_v<Real, float> ) {
+		return std::strtof( str, nullptr );
+	} else {
+		return std::strtod( str, nullptr );
+	}
+}
+
+template<typename Real>
+bool same_bits( Real lhs, Real rhs ) {
+	return std::memcmp( &lhs, &rhs, sizeof( Real ) ) == 0;
+}
+
+template<typename Real, bool KnownBounds>
+Real parse_precise( std::string_view number ) {
+	using namespace daw::json;
+	auto parse_state =
+	  BasicParsePolicy<parse_options( options::IEEE754Precise::yes )>(
+	    std::data( number ), daw::data_end( number ) );
+	if constexpr( KnownBounds ) {
+		parse_state = json_details::skip_number( parse_state );
+	}
+	using json_member = json_details::json_deduced_type<Real>;
+	return json_details::parse_value_real<json_member, KnownBounds>(
+	  parse_state );
+}
+
+template<typename Real>
+void test_number( char const *str ) {
+	auto const expected = parse_with_libc<Real>( str );
+	test_assert( same_bits( parse_precise<Real, false>( str ), expected ),
+	             "Unknown bounds differ from strtod" );
+	test_assert( same_bits( parse_precise<Real, true>( str ), expected ),
+	             "Known bounds differ from strtod" );
+}
+
+template<typename Real>
+void test_precise( ) {
+	// Halfway, subnormal, overflow and too many digits for a std::uint64_t
+	for( char const *str :
+	     { "0", "-0", "1", "-65.613616999999977", "0.1", "1e23", "8.41e21",
+	       "9007199254740993", "1.7976931348623157e308", "1.8e308",
+	       "2.2250738585072011e-308", "4.9406564584124654e-324",
+	       "2.4703282292062327e-324", "2.4703282292062328e-324", "3.4028235e38",
+	       "1.4e-45", "7e-46", "1.00000005960464477539062499",
+	       "1.000000059604644775390625", "1e-400",
+	       "123456789012345678901234" } ) {
+		test_number<Real>( str );
+	}
+
+	auto rng = std::mt19937_64( 42 );
+	char buffer[64];
+	for( int n = 0; n < 1'000'000; ++n ) {
+		std::uint64_t const bits = rng( );
+		Real value;
+		if constexpr( std::is_same_v<Real, float> ) {
+			auto const bits32 = static_cast<std::uint32_t>( bits );
+			std::memcpy( &value, &bits32, sizeof( value ) );
+		} else {
+			std::memcpy( &value, &bits, sizeof( value ) );
+		}
+		if( not std::isfinite( value ) ) {
+			// NaN and infinity are not JSON numbers
+			continue;
+		}
+		std::snprintf( buffer, sizeof( buffer ), "%.17g",
+		               static_cast<double>( value ) );
+		test_number<Real>( buffer );
+		std::snprintf( buffer, sizeof( buffer ), "%.9g",
+		               static_cast<double>( value ) );
+		test_number<Real>( buffer );
+	}
+}
+
+int main( int, char ** )
+#if defined( DAW_USE_EXCEPTIONS )
+  try
+#endif
+{
+	test_precise<double>( );
+	test_precise<float>( );
+	std::cout << "done\n";
+}
+#if defined( DAW_USE_EXCEPTIONS )
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+}
+#endif
@@ -232,6 +232,78 @@ void test_func( ) {
 		}
 	}
 
+	{ // just ints, counted before parsing
+		auto const count = *daw::bench_n_test_mbs<DAW_NUM_RUNS>(
+		  "array of intmax_t: from_json_array exact sizing",
+		  json_sv_intmax.size( ),
+		  []( auto &&sv ) noexcept {
+			  auto const data = from_json_array<intmax_t, std::vector<intmax_t>>(
+			    sv, options::parse_flags<options::CheckedParseMode::no,
+			                             options::ExactArraySizing::yes> );
+			  daw::do_not_optimize( data );
+			  return data.size( );
+		  },
+		  json_sv_intmax );
+		std::cout << "element count: " << count << '\n';
+
+		auto const count2 = *daw::bench_n_test_mbs<DAW_NUM_RUNS>(
+		  "array of intmax_t: from_json_array exact sizing best_available",
+		  json_sv_intmax.size( ),
+		  []( auto &&sv ) noexcept {
+			  auto const data = from_json_array<intmax_t, std::vector<intmax_t>>(
+			    sv, options::parse_flags<options::CheckedParseMode::no,
+			                             options::ExactArraySizing::yes,
+			                             options::ExecModeTypes::best_available> );
+			  daw::do_not_optimize( data );
+			  return data.size( );
+		  },
+		  json_sv_intmax );
+		std::cout << "element count: " << count2 << '\n';
+
+		auto const expected =
+		  from_json_array<intmax_t, std::vector<intmax_t>>( json_sv_intmax );
+		auto const exact = from_json_array<intmax_t, std::vector<intmax_t>>(
+		  json_sv_intmax,
+		  options::parse_flags<options::ExactArraySizing::yes,
+		                       options::ExecModeTypes::best_available> );
+		test_assert( exact == expected, "Exact sizing changed the result" );
+		test_assert( exact.capacity( ) == exact.size( ),
+		             "Expected the vector to be sized exactly" );
+	}
+
+	{ // just ints, 16 digits at a time with SSE4.1/AVX2
+		auto const expected =
+		  from_json_array<intmax_t, std::vector<intmax_t>>( json_sv_intmax );
+		auto const count = *daw::bench_n_test_mbs<DAW_NUM_RUNS>(
+		  "array of intmax_t: from_json_array best_available",
+		  json_sv_intmax.size( ),
+		  [&]( auto &&sv ) noexcept {
+			  auto const data = from_json_array<intmax_t, std::vector<intmax_t>>(
+			    sv, options::parse_flags<options::CheckedParseMode::no,
+			                             options::ExecModeTypes::best_available> );
+			  daw::do_not_optimize( data );
+			  return data == expected ? data.size( ) : 0U;
+		  },
+		  json_sv_intmax );
+		std::cout << "element count: " << count << '\n';
+		test_assert( count == NUMVALUES,
+		             "best_available parsed different integers" );
+#if defined( DAW_ALLOW_SSE42 )
+		auto const count2 = *daw::bench_n_test_mbs<DAW_NUM_RUNS>(
+		  "array of intmax_t: from_json_array simd", json_sv_intmax.size( ),
+		  [&]( auto &&sv ) noexcept {
+			  auto const data = from_json_array<intmax_t, std::vector<intmax_t>>(
+			    sv, options::parse_flags<options::CheckedParseMode::no,
+			                             options::ExecModeTypes::simd> );
+			  daw::do_not_optimize( data );
+			  return data == expected ? data.size( ) : 0U;
+		  },
+		  json_sv_intmax );
+		std::cout << "element count: " << count2 << '\n';
+		test_assert( count2 == NUMVALUES, "simd parsed different integers" );
+#endif
+	}
+
 	std::cout << "Checked\n";
 	{ // Class of ints
 		auto json_sv = std::string_view( json_data );
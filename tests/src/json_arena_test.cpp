@@ -0,0 +1,161 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+// Check json_arena block growth, alignment, reuse of the last allocation and
+// release( ), json_arena_allocator, and that from_json_arena results allocate
+// from the arena
+
+#include "defines.h"
+
+#include <daw/json/daw_json_arena.h>
+#include <daw/json/daw_json_link.h>
+
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <utility>
+
+namespace tests {
+	struct alignas( 64 ) wide_t {
+		unsigned char data[64];
+	};
+
+	bool is_aligned( void const *ptr, std::size_t alignment ) {
+		return reinterpret_cast<std::uintptr_t>( ptr ) % alignment == 0;
+	}
+} // namespace tests
+
+void test_arena( ) {
+	using daw::json::json_arena;
+	json_arena arena( 256 );
+	test_assert( arena.stats( ).block_count == 0,
+	             "No block until the first allocation" );
+
+	void *const a = arena.allocate( 1, 1 );
+	void *const b = arena.allocate( 64, 64 );
+	test_assert( tests::is_aligned( b, 64 ), "Over aligned allocation" );
+	test_assert( arena.stats( ).block_count == 1, "Expected one block" );
+
+	// The last allocation is given back, the one before it is not
+	arena.deallocate( b, 64 );
+	test_assert( arena.allocate( 64, 64 ) == b, "Last allocation reused" );
+	arena.deallocate( a, 1 );
+	test_assert( arena.allocate( 1, 1 ) != a, "Only the last is reused" );
+
+	// Larger than the next block, so the block is sized to fit
+	void *const big = arena.allocate( 4096, 16 );
+	test_assert( tests::is_aligned( big, 16 ), "Large allocation alignment" );
+	auto const &stats = arena.stats( );
+	test_assert( stats.block_count == 2 and stats.bytes_reserved > 4096,
+	             "Expected a block for the large allocation" );
+	test_assert( stats.allocation_count == 5 and
+	               stats.bytes_allocated == 1 + 64 + 64 + 1 + 4096,
+	             "Unexpected counters" );
+	test_assert( stats.live_bytes == 64 + 1 + 4096 and
+	               stats.peak_live_bytes == 64 + 1 + 4096,
+	             "Unexpected live bytes" );
+
+	// release keeps the newest block, which fits the large allocation again
+	arena.release( );
+	test_assert( arena.stats( ).block_count == 1 and
+	               arena.stats( ).allocation_count == 0 and
+	               arena.stats( ).live_bytes == 0,
+	             "release should keep one block and reset the counters" );
+	(void)arena.allocate( 4096, 16 );
+	test_assert( arena.stats( ).block_count == 1, "The kept block is reused" );
+
+	auto moved = json_arena( std::move( arena ) );
+	test_assert( moved.stats( ).block_count == 1 and
+	               arena.stats( ).block_count == 0,
+	             "Moving an arena moves its blocks" );
+	arena.release( );
+}
+
+void test_allocator( ) {
+	using namespace daw::json;
+	json_arena arena;
+	json_arena other;
+	auto const alloc = json_arena_allocator<int>( arena );
+	auto const rebound = json_arena_allocator<tests::wide_t>( alloc );
+	test_assert( rebound.arena( ) == &arena and rebound == alloc,
+	             "A rebound allocator uses the same arena" );
+	test_assert( json_arena_allocator<int>( other ) != alloc,
+	             "Allocators of different arenas are not equal" );
+
+	auto values = json_arena_vector<tests::wide_t>( rebound );
+	values.resize( 3 );
+	test_assert( tests::is_aligned( values.data( ), 64 ),
+	             "Vector elements are aligned" );
+
+	// A default constructed allocator uses the heap
+	auto const count = arena.stats( ).allocation_count;
+	auto heap_values = json_arena_vector<int>( 100, 1 );
+	test_assert( heap_values.get_allocator( ).arena( ) == nullptr and
+	               arena.stats( ).allocation_count == count,
+	             "Expected a heap allocation" );
+}
+
+void test_from_json_arena( ) {
+	using namespace daw::json;
+	using strings_t = json_arena_vector<json_arena_string>;
+	std::string const json_doc =
+	  R"({"a":["a string that does not fit in the small buffer",)"
+	  R"("another string that does not fit in the small buffer"],)"
+	  R"("b":{"a key that does not fit in the small buffer":1}})";
+
+	json_arena arena( 64 );
+	{
+		auto const result = from_json_arena<strings_t>( json_doc, "a", arena );
+		test_assert( result.size( ) == 2, "Unexpected number of strings" );
+		test_assert( result.get_allocator( ).arena( ) == &arena,
+		             "Result does not use the arena" );
+		for( auto const &str : result ) {
+			test_assert( str.get_allocator( ).arena( ) == &arena,
+			             "Elements do not use the arena" );
+		}
+		using counts_t = json_arena_unordered_map<json_arena_string, int>;
+		auto const counts = from_json_arena<json_key_value_no_name<
+		  counts_t, int, json_string_no_name<json_arena_string>>>( json_doc, "b",
+		                                                           arena );
+		test_assert( counts.at( json_arena_string(
+		               "a key that does not fit in the small buffer" ) ) == 1,
+		             "Unexpected map value" );
+		// The first block is too small for the strings
+		test_assert( arena.stats( ).block_count > 1,
+		             "Expected the arena to grow" );
+	}
+	arena.release( );
+
+#if defined( DAW_USE_EXCEPTIONS )
+	// A failed parse leaves the arena usable after release( )
+	bool has_error = false;
+	try {
+		(void)from_json_arena<strings_t>( R"(["a","b)", arena );
+	} catch( json_exception const & ) { has_error = true; }
+	test_assert( has_error, "Expected a parse error" );
+	arena.release( );
+	test_assert( from_json_arena<strings_t>( R"(["a"])", arena ).size( ) == 1,
+	             "Arena not usable after an error" );
+#endif
+}
+
+int main( int, char ** )
+#if defined( DAW_USE_EXCEPTIONS )
+  try
+#endif
+{
+	test_arena( );
+	test_allocator( );
+	test_from_json_arena( );
+	std::cout << "done\n";
+}
+#if defined( DAW_USE_EXCEPTIONS )
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+}
+#endif
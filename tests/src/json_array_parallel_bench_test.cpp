@@ -0,0 +1,119 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+/// @brief Time parallel_from_json_array with one thread up to all of them.
+/// The statuses of twitter.json and the performances of citm_catalog.json are
+/// repeated to make single large arrays of homogeneous records
+
+#include "daw_json_benchmark.h"
+#include "defines.h"
+
+#include "citm_test_json.h"
+#include "twitter_test_json.h"
+
+#include <daw/daw_read_file.h>
+#include <daw/json/daw_json_array_parallel.h>
+#include <daw/json/daw_json_link.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if not defined( DAW_NUM_RUNS )
+#if not defined( DEBUG ) or defined( NDEBUG )
+static inline constexpr std::size_t DAW_NUM_RUNS = 10;
+#else
+static inline constexpr std::size_t DAW_NUM_RUNS = 2;
+#endif
+#endif
+static_assert( DAW_NUM_RUNS > 0 );
+
+/// Repeat the elements of a serialized array until it is at least min_size
+std::string repeat_array( std::string const &json_array,
+                          std::size_t min_size ) {
+	auto const elements = json_array.substr( 1, json_array.size( ) - 2 );
+	auto result = std::string( "[" );
+	result.reserve( min_size + json_array.size( ) );
+	while( result.size( ) < min_size ) {
+		if( result.size( ) > 1 ) {
+			result += ',';
+		}
+		result += elements;
+	}
+	result += ']';
+	return result;
+}
+
+template<typename Element>
+void bench_scaling( std::string const &name, std::string const &json_array ) {
+	auto const expected_size =
+	  daw::json::from_json<std::vector<Element>>( json_array ).size( );
+	std::cout << name << ": " << expected_size << " elements, "
+	          << daw::json::benchmark::to_min_SI_unit_full( json_array.size( ) )
+	          << "B\n";
+	auto serial_count = daw::json::benchmark::benchmark(
+	  DAW_NUM_RUNS, json_array.size( ), name + " from_json",
+	  []( daw::string_view jd ) {
+		  return daw::json::from_json<std::vector<Element>>( jd ).size( );
+	  },
+	  json_array );
+	ensure( serial_count.has_value( ) );
+	ensure( serial_count.get( ) == expected_size );
+
+	auto const max_threads =
+	  std::max( std::size_t{ 1 },
+	            static_cast<std::size_t>( std::thread::hardware_concurrency( ) ) );
+	for( std::size_t thread_count = 1; thread_count <= max_threads;
+	     thread_count *= 2 ) {
+		auto opts = daw::json::json_array_parallel_options{ };
+		opts.thread_count = thread_count;
+		auto parallel_count = daw::json::benchmark::benchmark(
+		  DAW_NUM_RUNS, json_array.size( ),
+		  name + " parallel_from_json_array " + std::to_string( thread_count ) +
+		    " threads",
+		  [&opts]( daw::string_view jd ) {
+			  return daw::json::parallel_from_json_array<Element>( jd, opts )
+			    .size( );
+		  },
+		  json_array );
+		ensure( parallel_count.has_value( ) );
+		ensure( parallel_count.get( ) == expected_size );
+	}
+}
+
+int main( int argc, char **argv ) {
+	if( argc < 3 ) {
+		std::cerr << "Must supply the path to twitter.json and "
+		             "citm_catalog.json\n";
+		exit( EXIT_FAILURE );
+	}
+	// The size of each generated array in MB
+	std::size_t const array_mb =
+	  argc > 3 ? static_cast<std::size_t>( std::atoi( argv[3] ) ) : 256U;
+	std::size_t const min_size = array_mb * 1024U * 1024U;
+
+	{
+		auto const json_data = *daw::read_file( argv[1] );
+		auto const twitter = daw::json::from_json<daw::twitter::twitter_object_t>(
+		  std::string_view( json_data.data( ), json_data.size( ) ) );
+		bench_scaling<daw::twitter::tweet_object_t>(
+		  "twitter statuses",
+		  repeat_array( daw::json::to_json( twitter.statuses ), min_size ) );
+	}
+	{
+		auto const json_data = *daw::read_file( argv[2] );
+		auto const citm = daw::json::from_json<daw::citm::citm_object_t>(
+		  std::string_view( json_data.data( ), json_data.size( ) ) );
+		bench_scaling<daw::citm::performances_element_t>(
+		  "citm performances",
+		  repeat_array( daw::json::to_json( citm.performances ), min_size ) );
+	}
+}
@@ -0,0 +1,173 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+// Parse large arrays on several threads and check the results against the
+// serial from_json.  The elements have nested classes that start like the
+// elements and strings that look like element starts, so some of the split
+// point guesses are wrong
+
+#include "defines.h"
+
+#include <daw/json/daw_json_array_parallel.h>
+#include <daw/json/daw_json_link.h>
+
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include <vector>
+
+struct Child {
+	int id;
+	std::vector<int> values;
+};
+
+struct Element {
+	int id;
+	std::string name;
+	std::vector<Child> children;
+};
+
+namespace daw::json {
+	template<>
+	struct json_data_contract<Child> {
+		static constexpr char const id[] = "id";
+		static constexpr char const values[] = "values";
+		using type =
+		  json_member_list<json_link<id, int>,
+		                   json_link<values, std::vector<int>>>;
+	};
+
+	template<>
+	struct json_data_contract<Element> {
+		static constexpr char const id[] = "id";
+		static constexpr char const name[] = "name";
+		static constexpr char const children[] = "children";
+		using type =
+		  json_member_list<json_link<id, int>, json_link<name, std::string>,
+		                   json_link<children, std::vector<Child>>>;
+	};
+} // namespace daw::json
+
+std::string make_array( int count ) {
+	auto result = std::string( "[" );
+	for( int n = 0; n < count; ++n ) {
+		if( n > 0 ) {
+			result += n % 7 == 0 ? ",\n  " : ",";
+		}
+		result += R"({"id":)" + std::to_string( n ) +
+		          R"(,"name":"a,{\"id\":1,] \\","children":[)";
+		for( int c = 0; c < n % 4; ++c ) {
+			if( c > 0 ) {
+				result += ',';
+			}
+			result += R"({"id":)" + std::to_string( c ) + R"(,"values":[1,2,3]})";
+		}
+		result += "]}";
+	}
+	result += "]\n";
+	return result;
+}
+
+void check_elements( std::vector<Element> const &result,
+                     std::vector<Element> const &expected ) {
+	ensure( result.size( ) == expected.size( ) );
+	for( std::size_t n = 0; n < expected.size( ); ++n ) {
+		ensure( result[n].id == expected[n].id and
+		        result[n].name == expected[n].name and
+		        result[n].children.size( ) == expected[n].children.size( ) );
+	}
+}
+
+#if defined( DAW_USE_EXCEPTIONS )
+// The serial parse must fail too
+template<typename T>
+bool has_parse_error( std::string const &json_doc,
+                      daw::json::json_array_parallel_options const &opts ) {
+	using namespace daw::json;
+	bool has_serial_error = false;
+	try {
+		(void)from_json<std::vector<T>>( json_doc );
+	} catch( json_exception const & ) { has_serial_error = true; }
+	ensure( has_serial_error );
+	try {
+		(void)parallel_from_json_array<T>( json_doc, opts );
+	} catch( json_exception const & ) { return true; }
+	return false;
+}
+#endif
+
+int main( )
+#if defined( DAW_USE_EXCEPTIONS )
+  try
+#endif
+{
+	using namespace daw::json;
+	constexpr int count = 20'000;
+	auto const json_array = make_array( count );
+	auto const expected = from_json<std::vector<Element>>( json_array );
+	ensure( expected.size( ) == count );
+
+	for( std::size_t thread_count : { 1U, 2U, 3U, 8U } ) {
+		for( std::size_t min_partition_size : { 64U, 4096U, 1U << 30U } ) {
+			auto opts = json_array_parallel_options{ };
+			opts.thread_count = thread_count;
+			opts.min_partition_size = min_partition_size;
+			check_elements( parallel_from_json_array<Element>( json_array, opts ),
+			                expected );
+			check_elements(
+			  parallel_from_json_array<Element, options::CheckedParseMode::no>(
+			    json_array, opts ),
+			  expected );
+		}
+	}
+
+	auto opts = json_array_parallel_options{ };
+	opts.thread_count = 4;
+	opts.min_partition_size = 64;
+	auto const nested =
+	  R"({"before":[1,2],"items":)" + json_array + R"(,"after":[{"id":1}]})";
+	check_elements( parallel_from_json_array<Element>( nested, "items", opts ),
+	                expected );
+
+	auto const numbers = parallel_from_json_array<int>(
+	  R"([1, 2,3 , -4,5,6,7,8,9,10])", opts );
+	ensure( numbers.size( ) == 10 and numbers[3] == -4 and numbers[9] == 10 );
+	ensure( parallel_from_json_array<int>( " [ ] ", opts ).empty( ) );
+
+#if defined( DAW_USE_EXCEPTIONS )
+	// An error after the first range must still be reported
+	auto bad_array = json_array;
+	bad_array.insert( bad_array.find( R"({"id":15000,)" ) + 6, "x" );
+	ensure( has_parse_error<Element>( bad_array, opts ) );
+
+	// Elements that are not separated by a comma
+	ensure( has_parse_error<int>( "[1 2]", opts ) );
+	ensure( has_parse_error<int>( "[1,2 3,4]", opts ) );
+	ensure( has_parse_error<Child>(
+	  R"([{"id":1,"values":[]} {"id":2,"values":[]}])", opts ) );
+	auto missing_comma = json_array;
+	missing_comma[missing_comma.find( R"(,{"id":15000,)" )] = ' ';
+	ensure( has_parse_error<Element>( missing_comma, opts ) );
+	auto bad_separator = json_array;
+	bad_separator[bad_separator.find( R"(,{"id":9000,)" )] = ':';
+	ensure( has_parse_error<Element>( bad_separator, opts ) );
+
+	// A comma that is not followed by an element
+	ensure( has_parse_error<int>( "[1,]", opts ) );
+	ensure( has_parse_error<int>( "[1,2, ]", opts ) );
+	auto trailing_comma = json_array;
+	trailing_comma.insert( trailing_comma.rfind( ']' ), "," );
+	ensure( has_parse_error<Element>( trailing_comma, opts ) );
+#endif
+	std::cout << "done\n";
+}
+#if defined( DAW_USE_EXCEPTIONS )
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+}
+#endif
@@ -0,0 +1,115 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+// Serialize through json_buffered_output to a FILE * and a file descriptor
+// with buffers smaller than the pieces written and check the file against
+// to_json to a std::string
+
+#include "defines.h"
+
+#include <daw/json/daw_json_buffered_output.h>
+#include <daw/json/daw_json_link.h>
+
+#include <cstddef>
+#include <cstdio>
+#include <iostream>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#if defined( DAW_JSON_HAS_FD_STREAMS )
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+struct Element {
+	int a;
+	std::string b;
+	std::vector<double> c;
+};
+
+namespace daw::json {
+	template<>
+	struct json_data_contract<Element> {
+		static constexpr char const a[] = "a";
+		static constexpr char const b[] = "b";
+		static constexpr char const c[] = "c";
+		using type =
+		  json_member_list<json_link<a, int>, json_link<b, std::string>,
+		                   json_link<c, std::vector<double>>>;
+
+		static constexpr auto to_json_data( Element const &value ) {
+			return std::forward_as_tuple( value.a, value.b, value.c );
+		}
+	};
+} // namespace daw::json
+
+std::string read_file( std::string const &path ) {
+	std::FILE *in = std::fopen( path.c_str( ), "rb" );
+	ensure( in != nullptr );
+	auto result = std::string( );
+	char buffer[4096];
+	std::size_t count = 0;
+	while( ( count = std::fread( buffer, 1, sizeof( buffer ), in ) ) > 0 ) {
+		result.append( buffer, count );
+	}
+	std::fclose( in );
+	return result;
+}
+
+int main( )
+#if defined( DAW_USE_EXCEPTIONS )
+  try
+#endif
+{
+	auto elements = std::vector<Element>( );
+	for( int n = 0; n < 1'000; ++n ) {
+		// Some strings are longer than the smaller buffers
+		elements.push_back(
+		  Element{ n, std::string( static_cast<std::size_t>( n % 300 ), 'x' ) +
+		                "\"escaped\"\n",
+		           { 1.5 * n, -0.25, 1e100 } } );
+	}
+	auto const expected = daw::json::to_json( elements );
+	auto const path = std::string( "daw_json_buffered_output_test.json" );
+
+	for( std::size_t buffer_size : { 1U, 7U, 64U, 4096U, 1U << 20U } ) {
+		{
+			std::FILE *out = std::fopen( path.c_str( ), "wb" );
+			ensure( out != nullptr );
+			auto buffered = daw::json::json_buffered_output( out, buffer_size );
+			daw::json::to_json( elements, buffered );
+			buffered.flush( );
+			ensure( buffered.buffered_size( ) == 0 );
+			std::fclose( out );
+		}
+		ensure( read_file( path ) == expected );
+
+#if defined( DAW_JSON_HAS_FD_STREAMS )
+		{
+			int const fd =
+			  ::open( path.c_str( ), O_WRONLY | O_CREAT | O_TRUNC, 0644 );
+			ensure( fd >= 0 );
+			{
+				// The destructor writes what is left in the buffer
+				auto buffered = daw::json::json_buffered_output( fd, buffer_size );
+				daw::json::to_json( elements, buffered );
+			}
+			::close( fd );
+		}
+		ensure( read_file( path ) == expected );
+#endif
+	}
+	std::remove( path.c_str( ) );
+	std::cout << "done\n";
+}
+#if defined( DAW_USE_EXCEPTIONS )
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+}
+#endif
@@ -0,0 +1,141 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+// Parse documents directly from files with from_json_file,
+// json_array_range_file and json_lines_range_file
+
+#include "defines.h"
+
+#include <daw/json/daw_json_file.h>
+#include <daw/json/daw_json_link.h>
+
+#include <cstddef>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+struct Element {
+	int a;
+	std::string_view b;
+};
+
+namespace daw::json {
+	template<>
+	struct json_data_contract<Element> {
+		static constexpr char const a[] = "a";
+		static constexpr char const b[] = "b";
+		using type =
+		  json_member_list<json_link<a, int>, json_link<b, std::string_view>>;
+	};
+} // namespace daw::json
+
+std::string write_file( std::string const &name, std::string const &data ) {
+	auto const path =
+	  ( std::filesystem::temp_directory_path( ) / name ).string( );
+	auto out = std::ofstream( path, std::ios::binary | std::ios::trunc );
+	out.write( data.data( ), static_cast<std::streamsize>( data.size( ) ) );
+	ensure( out.good( ) );
+	return path;
+}
+
+std::string make_array( int count ) {
+	auto result = std::string( "[" );
+	for( int n = 0; n < count; ++n ) {
+		if( n > 0 ) {
+			result += ',';
+		}
+		result += R"({"a":)" + std::to_string( n ) + R"(,"b":"s)" +
+		          std::to_string( n ) + "\"}";
+	}
+	result += ']';
+	return result;
+}
+
+void check_elements( std::vector<Element> const &elements, int count ) {
+	ensure( elements.size( ) == static_cast<std::size_t>( count ) );
+	for( int n = 0; n < count; ++n ) {
+		auto const &e = elements[static_cast<std::size_t>( n )];
+		ensure( e.a == n and e.b == "s" + std::to_string( n ) );
+	}
+}
+
+int main( )
+#if defined( DAW_USE_EXCEPTIONS )
+  try
+#endif
+{
+	constexpr int count = 1'000;
+	auto const json_array = make_array( count );
+	auto const array_path = write_file( "daw_json_file_test.json", json_array );
+	{
+		auto const doc = daw::json::from_json_file<std::vector<Element>>(
+		  array_path,
+		  daw::json::options::parse_flags<
+		    daw::json::options::CheckedParseMode::no> );
+		// The string_views point into the mapped file
+		check_elements( doc.value, count );
+	}
+	{
+		auto const range =
+		  daw::json::json_array_range_file<Element>( array_path );
+		check_elements( std::vector<Element>( range.begin( ), range.end( ) ),
+		                count );
+		ensure( range.file( ).size( ) == json_array.size( ) );
+	}
+
+	// Files that end on a page boundary have no readable byte after them
+	constexpr int padded_count = 100;
+	for( std::size_t size : { 4096U, 16384U, 65536U } ) {
+		auto padded = make_array( padded_count );
+		ensure( padded.size( ) < size );
+		padded.resize( size, ' ' );
+		auto const padded_path =
+		  write_file( "daw_json_file_test_padded.json", padded );
+		auto const doc =
+		  daw::json::from_json_file<std::vector<Element>>( padded_path );
+		ensure( doc.file.size( ) == size );
+		check_elements( doc.value, padded_count );
+		std::remove( padded_path.c_str( ) );
+	}
+	std::remove( array_path.c_str( ) );
+
+	{
+		auto json_lines = std::string( );
+		for( int n = 0; n < count; ++n ) {
+			json_lines += R"({"a":)" + std::to_string( n ) + R"(,"b":"s)" +
+			              std::to_string( n ) + "\"}\n";
+		}
+		auto const lines_path =
+		  write_file( "daw_json_file_test.jsonl", json_lines );
+		auto const range =
+		  daw::json::json_lines_range_file<Element>( lines_path );
+		check_elements( std::vector<Element>( range.begin( ), range.end( ) ),
+		                count );
+		std::remove( lines_path.c_str( ) );
+	}
+
+#if defined( DAW_USE_EXCEPTIONS )
+	bool has_error = false;
+	try {
+		(void)daw::json::json_mapped_file( "/this/file/does/not/exist.json" );
+	} catch( daw::json::json_exception const &jex ) {
+		has_error = jex.reason_type( ) == daw::json::ErrorReason::UnableToOpenFile;
+	}
+	ensure( has_error );
+#endif
+	std::cout << "done\n";
+}
+#if defined( DAW_USE_EXCEPTIONS )
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+}
+#endif
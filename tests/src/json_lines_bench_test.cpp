@@ -16,12 +16,16 @@
 #include <daw/daw_algorithm.h>
 #include <daw/daw_memory_mapped_file.h>
 #include <daw/json/daw_json_lines_iterator.h>
+#include <daw/json/daw_json_lines_parallel.h>
 #include <daw/json/daw_json_link.h>
 
+#include <algorithm>
+#include <atomic>
 #include <cstdlib>
 #include <future>
 #include <iostream>
 #include <numeric>
+#include <string>
 #include <thread>
 
 #if not defined( DAW_NUM_RUNS )
@@ -175,4 +179,32 @@ int main( int argc, char **argv ) {
 	  unchkpartitions );
 	ensure( typed_unchecked_threaded_count.has_value( ) );
 	ensure( typed_unchecked_threaded_count.get( ) == real_count.get( ) );
+
+	// Scaling of parallel_for_each_jsonl from one thread to all of them
+	auto const max_threads =
+	  std::max( std::size_t{ 1 },
+	            static_cast<std::size_t>( std::thread::hardware_concurrency( ) ) );
+	for( std::size_t thread_count = 1; thread_count <= max_threads;
+	     ++thread_count ) {
+		auto opts = daw::json::jsonl_parallel_options{ };
+		opts.thread_count = thread_count;
+		auto const title = "json_lines typed parallel_for_each_jsonl unchecked " +
+		                   std::to_string( thread_count ) + " threads";
+		auto parallel_count = daw::json::benchmark::benchmark(
+		  DAW_NUM_RUNS * 10, jsonl_doc.size( ), title,
+		  [&opts]( daw::string_view jd ) {
+			  auto count = std::atomic<std::size_t>{ 0 };
+			  daw::json::parallel_for_each_jsonl<
+			    jsonl_entry, daw::json::options::CheckedParseMode::no>(
+			    jd,
+			    [&count]( jsonl_entry entry ) {
+				    count.fetch_add( entry.body.size( ), std::memory_order_relaxed );
+			    },
+			    opts );
+			  return count.load( );
+		  },
+		  jsonl_doc );
+		ensure( parallel_count.has_value( ) );
+		ensure( parallel_count.get( ) == real_count.get( ) );
+	}
 }
@@ -0,0 +1,112 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+// Parse a JSON Lines document on several threads and check the results against
+// the serial json_lines_range
+
+#include "defines.h"
+
+#include <daw/json/daw_json_lines_parallel.h>
+#include <daw/json/daw_json_link.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include <vector>
+
+struct Element {
+	int a;
+	bool b;
+};
+
+namespace daw::json {
+	template<>
+	struct json_data_contract<Element> {
+		static constexpr char const a[] = "a";
+		static constexpr char const b[] = "b";
+		using type = json_member_list<json_link<a, int>, json_link<b, bool>>;
+	};
+} // namespace daw::json
+
+int main( )
+#if defined( DAW_USE_EXCEPTIONS )
+  try
+#endif
+{
+	constexpr int line_count = 10'000;
+	auto json_lines = std::string( );
+	for( int n = 0; n < line_count; ++n ) {
+		json_lines += R"({"a":)" + std::to_string( n ) + R"(,"b":)" +
+		              ( n % 3 == 0 ? "true" : "false" ) + "}\n";
+	}
+
+	auto const serial = [&] {
+		auto lines_range = daw::json::json_lines_range<Element>( json_lines );
+		return std::vector<Element>( lines_range.begin( ), lines_range.end( ) );
+	}( );
+	ensure( serial.size( ) == line_count );
+
+	for( std::size_t thread_count : { 1U, 2U, 3U, 8U } ) {
+		auto opts = daw::json::jsonl_parallel_options{ };
+		opts.thread_count = thread_count;
+
+		auto const ordered =
+		  daw::json::parallel_from_jsonl<Element>( json_lines, opts );
+		ensure( ordered.size( ) == serial.size( ) );
+		for( std::size_t n = 0; n < serial.size( ); ++n ) {
+			ensure( ordered[n].a == serial[n].a and ordered[n].b == serial[n].b );
+		}
+
+		opts.preserve_order = false;
+		auto unordered =
+		  daw::json::parallel_from_jsonl<Element>( json_lines, opts );
+		ensure( unordered.size( ) == serial.size( ) );
+		std::sort( unordered.begin( ), unordered.end( ),
+		           []( Element const &lhs, Element const &rhs ) {
+			           return lhs.a < rhs.a;
+		           } );
+		for( std::size_t n = 0; n < serial.size( ); ++n ) {
+			ensure( unordered[n].a == serial[n].a and
+			        unordered[n].b == serial[n].b );
+		}
+
+		auto sum = std::atomic<long long>{ 0 };
+		auto true_count = std::atomic<std::size_t>{ 0 };
+		daw::json::parallel_for_each_jsonl<Element>(
+		  json_lines,
+		  [&]( Element const &e ) {
+			  sum += e.a;
+			  if( e.b ) {
+				  ++true_count;
+			  }
+		  },
+		  opts );
+		ensure( sum == static_cast<long long>( line_count ) *
+		                 ( line_count - 1 ) / 2 );
+		ensure( true_count == ( line_count + 2 ) / 3 );
+	}
+
+	ensure( daw::json::parallel_from_jsonl<Element>( "" ).empty( ) );
+
+#if defined( DAW_USE_EXCEPTIONS )
+	bool has_error = false;
+	try {
+		(void)daw::json::parallel_from_jsonl<Element>(
+		  json_lines + R"({"a":"oops","b":true})" + '\n' );
+	} catch( daw::json::json_exception const & ) { has_error = true; }
+	ensure( has_error );
+#endif
+	std::cout << "done\n";
+}
+#if defined( DAW_USE_EXCEPTIONS )
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+}
+#endif
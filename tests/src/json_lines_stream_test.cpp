@@ -0,0 +1,114 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+// Read a JSON Lines document from a FILE * and a file descriptor with buffers
+// smaller than the records and check the results against json_lines_range
+
+#include "defines.h"
+
+#include <daw/json/daw_json_link.h>
+#include <daw/json/daw_json_lines_stream.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdio>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#if defined( DAW_JSON_HAS_FD_STREAMS )
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+struct Element {
+	int a;
+	std::string b;
+};
+
+namespace daw::json {
+	template<>
+	struct json_data_contract<Element> {
+		static constexpr char const a[] = "a";
+		static constexpr char const b[] = "b";
+		using type =
+		  json_member_list<json_link<a, int>, json_link<b, std::string>>;
+	};
+} // namespace daw::json
+
+template<typename Stream>
+void check_stream( Stream &stream, std::vector<Element> const &expected ) {
+	std::size_t n = 0;
+	for( Element const &e : stream ) {
+		ensure( n < expected.size( ) );
+		ensure( e.a == expected[n].a and e.b == expected[n].b );
+		++n;
+	}
+	ensure( n == expected.size( ) );
+}
+
+int main( )
+#if defined( DAW_USE_EXCEPTIONS )
+  try
+#endif
+{
+	constexpr int line_count = 2'000;
+	auto json_lines = std::string( );
+	for( int n = 0; n < line_count; ++n ) {
+		// Some records are longer than the smallest buffers
+		json_lines += R"({"a":)" + std::to_string( n ) + R"(,"b":")" +
+		              std::string( static_cast<std::size_t>( n % 97 ), 'x' ) +
+		              "\"}\n";
+		if( n % 500 == 0 ) {
+			json_lines += "\n";
+		}
+	}
+	// No newline after the last record
+	json_lines += R"({"a":-1,"b":"last"})";
+
+	auto const expected = [&] {
+		auto lines_range = daw::json::json_lines_range<Element>( json_lines );
+		return std::vector<Element>( lines_range.begin( ), lines_range.end( ) );
+	}( );
+	ensure( expected.size( ) == line_count + 1 );
+
+	auto const path = std::string( "daw_json_lines_stream_test.jsonl" );
+	{
+		std::FILE *out = std::fopen( path.c_str( ), "wb" );
+		ensure( out != nullptr );
+		ensure( std::fwrite( json_lines.data( ), 1, json_lines.size( ), out ) ==
+		        json_lines.size( ) );
+		std::fclose( out );
+	}
+
+	for( std::size_t buffer_size : { 1U, 16U, 100U, 4096U, 1U << 20U } ) {
+		std::FILE *in = std::fopen( path.c_str( ), "rb" );
+		ensure( in != nullptr );
+		auto stream = daw::json::json_lines_stream<Element>( in, buffer_size );
+		check_stream( stream, expected );
+		std::fclose( in );
+		// The buffer only grows to fit the longest record
+		ensure( stream.buffer_size( ) <=
+		        std::max( buffer_size, std::size_t{ 256 } ) );
+
+#if defined( DAW_JSON_HAS_FD_STREAMS )
+		int const fd = ::open( path.c_str( ), O_RDONLY );
+		ensure( fd >= 0 );
+		auto fd_stream = daw::json::json_lines_stream<Element>( fd, buffer_size );
+		check_stream( fd_stream, expected );
+		::close( fd );
+#endif
+	}
+	std::remove( path.c_str( ) );
+	std::cout << "done\n";
+}
+#if defined( DAW_USE_EXCEPTIONS )
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+}
+#endif
@@ -0,0 +1,110 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+// Feed documents to json_push_parser in chunks of every size and check that
+// the elements match parsing the whole document
+
+#include "defines.h"
+
+#include <daw/json/daw_json_link.h>
+#include <daw/json/daw_json_push_parser.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+struct Element {
+	std::string name;
+	double value;
+	std::vector<int> items;
+};
+
+namespace daw::json {
+	template<>
+	struct json_data_contract<Element> {
+		static constexpr char const name[] = "name";
+		static constexpr char const value[] = "value";
+		static constexpr char const items[] = "items";
+		using type = json_member_list<json_string<name>, json_number<value>,
+		                              json_array<items, int>>;
+	};
+} // namespace daw::json
+
+template<typename Parser, typename Callback>
+void feed_in_chunks( Parser &parser, std::string_view doc,
+                     std::size_t chunk_size, Callback on_element ) {
+	while( not doc.empty( ) ) {
+		auto const sz = std::min( chunk_size, doc.size( ) );
+		// Copy each chunk so that nothing can refer to the previous ones
+		auto const chunk = std::string( doc.substr( 0, sz ) );
+		parser.feed( chunk, on_element );
+		doc.remove_prefix( sz );
+	}
+	parser.finish( on_element );
+}
+
+int main( )
+#if defined( DAW_USE_EXCEPTIONS )
+  try
+#endif
+{
+	std::string_view const json_doc = R"( [
+  {"name":"a \"quoted\" [name]","value":1.5e2,"items":[1,2,3]},
+  {"items":[],"value":-0.25,"name":"é\\"},
+  {"name":"{}","value":12345678.875,"items":[42]}
+] )";
+	auto const expected = daw::json::from_json_array<Element>( json_doc );
+	ensure( expected.size( ) == 3 );
+
+	auto parser = daw::json::json_push_parser<Element>( );
+	for( std::size_t chunk_size = 1; chunk_size <= json_doc.size( );
+	     ++chunk_size ) {
+		auto elements = std::vector<Element>( );
+		feed_in_chunks( parser, json_doc, chunk_size, [&]( Element e ) {
+			elements.push_back( std::move( e ) );
+		} );
+		ensure( elements.size( ) == expected.size( ) );
+		for( std::size_t n = 0; n < elements.size( ); ++n ) {
+			ensure( elements[n].name == expected[n].name );
+			ensure( elements[n].value == expected[n].value );
+			ensure( elements[n].items == expected[n].items );
+		}
+	}
+
+	// A sequence of values, the last number ends with the document
+	std::string_view const values_doc = "1\n22 333\n-4.5e1";
+	auto value_parser = daw::json::json_push_parser<double>( );
+	for( std::size_t chunk_size = 1; chunk_size <= values_doc.size( );
+	     ++chunk_size ) {
+		auto values = std::vector<double>( );
+		feed_in_chunks( value_parser, values_doc, chunk_size, [&]( double d ) {
+			values.push_back( d );
+		} );
+		ensure( values == std::vector<double>{ 1.0, 22.0, 333.0, -45.0 } );
+	}
+
+#if defined( DAW_USE_EXCEPTIONS )
+	for( std::string_view bad_doc : { "[1,]", "[1 2]", "[1", "[\"ab", "[1]x" } ) {
+		auto bad_parser = daw::json::json_push_parser<int>( );
+		bool has_error = false;
+		try {
+			feed_in_chunks( bad_parser, bad_doc, 1, []( int ) {} );
+		} catch( daw::json::json_exception const & ) { has_error = true; }
+		ensure( has_error );
+	}
+#endif
+	std::cout << "done\n";
+}
+#if defined( DAW_USE_EXCEPTIONS )
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+}
+#endif
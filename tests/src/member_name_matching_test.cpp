@@ -0,0 +1,257 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+// Parse a class with 64 members, whose names only differ in two bytes, with
+// options::MemberNameMatching::length_and_bytes.  The documents have the
+// members shuffled and unmapped members with the same signature as mapped
+// ones.  The hash and hash_linear_scan parses are checked the same way
+
+#include "defines.h"
+
+#include <daw/json/daw_json_link.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace tests {
+	inline constexpr std::size_t member_count = 64;
+
+	struct wide_class_t {
+		std::array<int, member_count> f;
+
+		template<typename... Ints>
+		explicit wide_class_t( Ints... values )
+		  : f{ values... } {}
+	};
+} // namespace tests
+
+namespace daw::json {
+	template<>
+	struct json_data_contract<tests::wide_class_t> {
+		static constexpr char const f00[] = "event_field_00";
+		static constexpr char const f01[] = "event_field_01";
+		static constexpr char const f02[] = "event_field_02";
+		static constexpr char const f03[] = "event_field_03";
+		static constexpr char const f04[] = "event_field_04";
+		static constexpr char const f05[] = "event_field_05";
+		static constexpr char const f06[] = "event_field_06";
+		static constexpr char const f07[] = "event_field_07";
+		static constexpr char const f08[] = "event_field_08";
+		static constexpr char const f09[] = "event_field_09";
+		static constexpr char const f10[] = "event_field_10";
+		static constexpr char const f11[] = "event_field_11";
+		static constexpr char const f12[] = "event_field_12";
+		static constexpr char const f13[] = "event_field_13";
+		static constexpr char const f14[] = "event_field_14";
+		static constexpr char const f15[] = "event_field_15";
+		static constexpr char const f16[] = "event_field_16";
+		static constexpr char const f17[] = "event_field_17";
+		static constexpr char const f18[] = "event_field_18";
+		static constexpr char const f19[] = "event_field_19";
+		static constexpr char const f20[] = "event_field_20";
+		static constexpr char const f21[] = "event_field_21";
+		static constexpr char const f22[] = "event_field_22";
+		static constexpr char const f23[] = "event_field_23";
+		static constexpr char const f24[] = "event_field_24";
+		static constexpr char const f25[] = "event_field_25";
+		static constexpr char const f26[] = "event_field_26";
+		static constexpr char const f27[] = "event_field_27";
+		static constexpr char const f28[] = "event_field_28";
+		static constexpr char const f29[] = "event_field_29";
+		static constexpr char const f30[] = "event_field_30";
+		static constexpr char const f31[] = "event_field_31";
+		static constexpr char const f32[] = "event_field_32";
+		static constexpr char const f33[] = "event_field_33";
+		static constexpr char const f34[] = "event_field_34";
+		static constexpr char const f35[] = "event_field_35";
+		static constexpr char const f36[] = "event_field_36";
+		static constexpr char const f37[] = "event_field_37";
+		static constexpr char const f38[] = "event_field_38";
+		static constexpr char const f39[] = "event_field_39";
+		static constexpr char const f40[] = "event_field_40";
+		static constexpr char const f41[] = "event_field_41";
+		static constexpr char const f42[] = "event_field_42";
+		static constexpr char const f43[] = "event_field_43";
+		static constexpr char const f44[] = "event_field_44";
+		static constexpr char const f45[] = "event_field_45";
+		static constexpr char const f46[] = "event_field_46";
+		static constexpr char const f47[] = "event_field_47";
+		static constexpr char const f48[] = "event_field_48";
+		static constexpr char const f49[] = "event_field_49";
+		static constexpr char const f50[] = "event_field_50";
+		static constexpr char const f51[] = "event_field_51";
+		static constexpr char const f52[] = "event_field_52";
+		static constexpr char const f53[] = "event_field_53";
+		static constexpr char const f54[] = "event_field_54";
+		static constexpr char const f55[] = "event_field_55";
+		static constexpr char const f56[] = "event_field_56";
+		static constexpr char const f57[] = "event_field_57";
+		static constexpr char const f58[] = "event_field_58";
+		static constexpr char const f59[] = "event_field_59";
+		static constexpr char const f60[] = "event_field_60";
+		static constexpr char const f61[] = "event_field_61";
+		static constexpr char const f62[] = "event_field_62";
+		static constexpr char const f63[] = "event_field_63";
+
+		using type = json_member_list<
+		  json_number<f00, int>,
+		  json_number<f01, int>,
+		  json_number<f02, int>,
+		  json_number<f03, int>,
+		  json_number<f04, int>,
+		  json_number<f05, int>,
+		  json_number<f06, int>,
+		  json_number<f07, int>,
+		  json_number<f08, int>,
+		  json_number<f09, int>,
+		  json_number<f10, int>,
+		  json_number<f11, int>,
+		  json_number<f12, int>,
+		  json_number<f13, int>,
+		  json_number<f14, int>,
+		  json_number<f15, int>,
+		  json_number<f16, int>,
+		  json_number<f17, int>,
+		  json_number<f18, int>,
+		  json_number<f19, int>,
+		  json_number<f20, int>,
+		  json_number<f21, int>,
+		  json_number<f22, int>,
+		  json_number<f23, int>,
+		  json_number<f24, int>,
+		  json_number<f25, int>,
+		  json_number<f26, int>,
+		  json_number<f27, int>,
+		  json_number<f28, int>,
+		  json_number<f29, int>,
+		  json_number<f30, int>,
+		  json_number<f31, int>,
+		  json_number<f32, int>,
+		  json_number<f33, int>,
+		  json_number<f34, int>,
+		  json_number<f35, int>,
+		  json_number<f36, int>,
+		  json_number<f37, int>,
+		  json_number<f38, int>,
+		  json_number<f39, int>,
+		  json_number<f40, int>,
+		  json_number<f41, int>,
+		  json_number<f42, int>,
+		  json_number<f43, int>,
+		  json_number<f44, int>,
+		  json_number<f45, int>,
+		  json_number<f46, int>,
+		  json_number<f47, int>,
+		  json_number<f48, int>,
+		  json_number<f49, int>,
+		  json_number<f50, int>,
+		  json_number<f51, int>,
+		  json_number<f52, int>,
+		  json_number<f53, int>,
+		  json_number<f54, int>,
+		  json_number<f55, int>,
+		  json_number<f56, int>,
+		  json_number<f57, int>,
+		  json_number<f58, int>,
+		  json_number<f59, int>,
+		  json_number<f60, int>,
+		  json_number<f61, int>,
+		  json_number<f62, int>,
+		  json_number<f63, int>>;
+	};
+} // namespace daw::json
+
+template<typename>
+inline constexpr bool has_name_signature = false;
+
+template<typename... JsonMembers>
+inline constexpr bool
+  has_name_signature<daw::json::json_member_list<JsonMembers...>> =
+    daw::json::json_details::find_name_signature_positions<
+      JsonMembers...>( ).found;
+
+static_assert(
+  has_name_signature<
+    daw::json::json_data_contract<tests::wide_class_t>::type>,
+  "The length and the last two bytes tell the member names apart" );
+
+std::string make_json_data( std::size_t count ) {
+	auto rng = std::mt19937( 42 );
+	auto order = std::array<std::size_t, tests::member_count>{ };
+	std::iota( order.begin( ), order.end( ), std::size_t{ 0 } );
+	std::string result = "[";
+	for( std::size_t n = 0; n < count; ++n ) {
+		std::shuffle( order.begin( ), order.end( ), rng );
+		result += '{';
+		for( std::size_t m : order ) {
+			auto const digits = std::string{ static_cast<char>( '0' + m / 10 ),
+			                                 static_cast<char>( '0' + m % 10 ) };
+			// Same length and last two bytes as a mapped name
+			if( m % 7 == n % 7 ) {
+				result += "\"event_other_" + digits + "\":-1,";
+			}
+			result += "\"event_field_" + digits + "\":" +
+			          std::to_string( n * 100 + m ) + ',';
+		}
+		result.back( ) = '}';
+		result += ',';
+	}
+	result.back( ) = ']';
+	return result;
+}
+
+bool validate( std::vector<tests::wide_class_t> const &values ) {
+	for( std::size_t n = 0; n < values.size( ); ++n ) {
+		for( std::size_t m = 0; m < tests::member_count; ++m ) {
+			if( values[n].f[m] != static_cast<int>( n * 100 + m ) ) {
+				return false;
+			}
+		}
+	}
+	return true;
+}
+
+int main( int, char ** )
+#if defined( DAW_USE_EXCEPTIONS )
+  try
+#endif
+{
+	using namespace daw::json;
+	std::string const json_data = make_json_data( 20 );
+	auto const hashed = from_json<std::vector<tests::wide_class_t>>( json_data );
+	test_assert( validate( hashed ), "Members were not matched correctly" );
+
+	auto const signatures = from_json<std::vector<tests::wide_class_t>>(
+	  json_data, options::parse_flags<
+	               options::MemberNameMatching::length_and_bytes> );
+	test_assert( validate( signatures ), "Members were not matched correctly" );
+
+	auto const unchecked = from_json<std::vector<tests::wide_class_t>>(
+	  json_data,
+	  options::parse_flags<options::MemberNameMatching::length_and_bytes,
+	                       options::CheckedParseMode::no> );
+	test_assert( validate( unchecked ), "Members were not matched correctly" );
+
+	auto const linear_scan = from_json<std::vector<tests::wide_class_t>>(
+	  json_data, options::parse_flags<
+	               options::MemberNameMatching::hash_linear_scan> );
+	test_assert( validate( linear_scan ), "Members were not matched correctly" );
+	std::cout << "done\n";
+}
+#if defined( DAW_USE_EXCEPTIONS )
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+}
+#endif
@@ -0,0 +1,53 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+// Part of nativejson_bench_alloc.  This file is built with DAW_JSON_TEST_ARENA
+
+#include "defines.h"
+
+#include "citm_test_json_alloc.h"
+#include "geojson_alloc.h"
+#include "json_test_alloc.h"
+#include "nativejson_alloc_report.h"
+#include "twitter_test_alloc_json.h"
+
+#include "daw/json/daw_json_link.h"
+
+#include <string_view>
+
+#if not defined( DAW_JSON_TEST_ARENA )
+#error "nativejson_alloc_report.cpp must be built with DAW_JSON_TEST_ARENA"
+#endif
+
+namespace daw {
+	nativejson_alloc_reports arena_alloc_reports( std::string_view twitter_json,
+	                                              std::string_view citm_json,
+	                                              std::string_view canada_json ) {
+		auto arena = json::json_arena( );
+		auto result = nativejson_alloc_reports{ };
+		{
+			auto const twitter_result =
+			  json::from_json_alloc<twitter::twitter_object_t>(
+			    twitter_json, test_allocator( arena ) );
+			result.twitter = alloc_report( arena );
+		}
+		arena.release( );
+		{
+			auto const citm_result = json::from_json_alloc<citm::citm_object_t>(
+			  citm_json, test_allocator( arena ) );
+			result.citm = alloc_report( arena );
+		}
+		arena.release( );
+		{
+			auto const canada_result = json::from_json_alloc<geojson::Polygon>(
+			  canada_json, "features[0].geometry", test_allocator( arena ) );
+			result.canada = alloc_report( arena );
+		}
+		arena.release( );
+		return result;
+	}
+} // namespace daw
@@ -10,6 +10,8 @@
 
 #include "citm_test_json_alloc.h"
 #include "geojson_alloc.h"
+#include "json_test_alloc.h"
+#include "nativejson_alloc_report.h"
 #include "twitter_test_alloc_json.h"
 
 #include "daw/json/daw_json_link.h"
@@ -31,7 +33,11 @@ static inline constexpr std::size_t DAW_NUM_RUNS = 2;
 #endif
 static_assert( DAW_NUM_RUNS > 0 );
 
+#if defined( DAW_JSON_TEST_ARENA )
+using AllocType = daw::json::json_arena;
+#else
 using AllocType = daw::fixed_allocator<char>;
+#endif
 using namespace daw::json::options;
 
 template<ExecModeTypes ExecMode>
@@ -70,10 +76,10 @@ void test( char **argv, AllocType &alloc ) {
 			  alloc.release( );
 			  twitter_result =
 			    daw::json::from_json_alloc<daw::twitter::twitter_object_t>(
-			      f1, alloc, parse_flags<ExecMode> );
+			      f1, daw::test_allocator( alloc ), parse_flags<ExecMode> );
 		  },
 		  json_sv1 );
-		std::cout << "Total Allocations: " << alloc.used( ) << " bytes\n";
+		daw::print_alloc_stats( alloc );
 		daw::do_not_optimize( twitter_result );
 #if defined( DAW_USE_EXCEPTIONS )
 	} catch( daw::json::json_exception const &jex ) {
@@ -98,11 +104,12 @@ void test( char **argv, AllocType &alloc ) {
 			  alloc.release( );
 			  twitter_result =
 			    daw::json::from_json_alloc<daw::twitter::twitter_object_t>(
-			      f1, alloc, parse_flags<ExecMode, CheckedParseMode::no> );
+			      f1, daw::test_allocator( alloc ),
+			      parse_flags<ExecMode, CheckedParseMode::no> );
 		  }
 	  },
 	  json_sv1 );
-	std::cout << "Total Allocations: " << alloc.used( ) << " bytes\n";
+	daw::print_alloc_stats( alloc );
 	daw::do_not_optimize( twitter_result );
 	test_assert( twitter_result, "Missing value" );
 	test_assert( not twitter_result->statuses.empty( ), "Expected values" );
@@ -119,10 +126,10 @@ void test( char **argv, AllocType &alloc ) {
 		  citm_result.reset( );
 		  alloc.release( );
 		  citm_result = daw::json::from_json_alloc<daw::citm::citm_object_t>(
-		    f2, alloc, parse_flags<ExecMode> );
+		    f2, daw::test_allocator( alloc ), parse_flags<ExecMode> );
 	  },
 	  json_sv2 );
-	std::cout << "Total Allocations: " << alloc.used( ) << " bytes\n";
+	daw::print_alloc_stats( alloc );
 	daw::do_not_optimize( citm_result );
 	test_assert( citm_result, "Missing value" );
 	test_assert( not citm_result->areaNames.empty( ), "Expected values" );
@@ -139,10 +146,11 @@ void test( char **argv, AllocType &alloc ) {
 		  citm_result.reset( );
 		  alloc.release( );
 		  citm_result = daw::json::from_json_alloc<daw::citm::citm_object_t>(
-		    f2, alloc, parse_flags<ExecMode, CheckedParseMode::no> );
+		    f2, daw::test_allocator( alloc ),
+		    parse_flags<ExecMode, CheckedParseMode::no> );
 	  },
 	  json_sv2 );
-	std::cout << "Total Allocations: " << alloc.used( ) << " bytes\n";
+	daw::print_alloc_stats( alloc );
 	test_assert( citm_result, "Missing value" );
 	test_assert( not citm_result->areaNames.empty( ), "Expected values" );
 	test_assert( citm_result->areaNames.count( 205706005 ) == 1,
@@ -159,10 +167,11 @@ void test( char **argv, AllocType &alloc ) {
 		  canada_result.reset( );
 		  alloc.release( );
 		  canada_result = daw::json::from_json_alloc<daw::geojson::Polygon>(
-		    f3, "features[0].geometry", alloc, parse_flags<ExecMode> );
+		    f3, "features[0].geometry", daw::test_allocator( alloc ),
+		    parse_flags<ExecMode> );
 	  },
 	  json_sv3 );
-	std::cout << "Total Allocations: " << alloc.used( ) << " bytes\n";
+	daw::print_alloc_stats( alloc );
 	daw::do_not_optimize( canada_result );
 	test_assert( canada_result, "Missing value" );
 
@@ -174,11 +183,11 @@ void test( char **argv, AllocType &alloc ) {
 		  canada_result.reset( );
 		  alloc.release( );
 		  canada_result = daw::json::from_json_alloc<daw::geojson::Polygon>(
-		    f3, "features[0].geometry", alloc,
+		    f3, "features[0].geometry", daw::test_allocator( alloc ),
 		    parse_flags<ExecMode, CheckedParseMode::no> );
 	  },
 	  json_sv3 );
-	std::cout << "Total Allocations: " << alloc.used( ) << " bytes\n";
+	daw::print_alloc_stats( alloc );
 	daw::do_not_optimize( canada_result );
 	test_assert( canada_result, "Missing value" );
 	canada_result.reset( );
@@ -194,15 +203,16 @@ void test( char **argv, AllocType &alloc ) {
 		  alloc.release( );
 		  twitter_result =
 		    daw::json::from_json_alloc<daw::twitter::twitter_object_t>(
-		      f1, alloc, parse_flags<ExecMode> );
+		      f1, daw::test_allocator( alloc ), parse_flags<ExecMode> );
 		  citm_result = daw::json::from_json_alloc<daw::citm::citm_object_t>(
-		    f2, alloc, parse_flags<ExecMode> );
+		    f2, daw::test_allocator( alloc ), parse_flags<ExecMode> );
 		  canada_result = daw::json::from_json_alloc<daw::geojson::Polygon>(
-		    f3, "features[0].geometry", alloc, parse_flags<ExecMode> );
+		    f3, "features[0].geometry", daw::test_allocator( alloc ),
+		    parse_flags<ExecMode> );
 	  },
 	  json_sv1, json_sv2, json_sv3 );
 
-	std::cout << "Total Allocations: " << alloc.used( ) << " bytes\n";
+	daw::print_alloc_stats( alloc );
 	std::cout << std::flush;
 
 	daw::do_not_optimize( twitter_result );
@@ -229,16 +239,18 @@ void test( char **argv, AllocType &alloc ) {
 		  alloc.release( );
 		  twitter_result =
 		    daw::json::from_json_alloc<daw::twitter::twitter_object_t>(
-		      f1, alloc, parse_flags<ExecMode, CheckedParseMode::no> );
+		      f1, daw::test_allocator( alloc ),
+		      parse_flags<ExecMode, CheckedParseMode::no> );
 		  citm_result = daw::json::from_json_alloc<daw::citm::citm_object_t>(
-		    f2, alloc, parse_flags<ExecMode, CheckedParseMode::no> );
+		    f2, daw::test_allocator( alloc ),
+		    parse_flags<ExecMode, CheckedParseMode::no> );
 		  canada_result = daw::json::from_json_alloc<daw::geojson::Polygon>(
-		    f3, "features[0].geometry", alloc,
+		    f3, "features[0].geometry", daw::test_allocator( alloc ),
 		    parse_flags<ExecMode, CheckedParseMode::no> );
 	  },
 	  json_sv1, json_sv2, json_sv3 );
 
-	std::cout << "Total Allocations: " << alloc.used( ) << " bytes\n";
+	daw::print_alloc_stats( alloc );
 	std::cout << std::flush;
 
 	daw::do_not_optimize( twitter_result );
@@ -262,6 +274,58 @@ void test( char **argv, AllocType &alloc ) {
 	alloc.release( );
 }
 
+#if not defined( DAW_JSON_TEST_ARENA )
+// Parse each document once with the fixed_allocator and once with a json_arena
+// and print the allocations of both
+void compare_allocators( char **argv, AllocType &alloc ) {
+	auto const json_data1 = *daw::read_file( argv[1] );
+	auto const json_data2 = *daw::read_file( argv[2] );
+	auto const json_data3 = *daw::read_file( argv[3] );
+	auto json_sv1 = std::string_view( json_data1.data( ), json_data1.size( ) );
+	auto json_sv2 = std::string_view( json_data2.data( ), json_data2.size( ) );
+	auto json_sv3 = std::string_view( json_data3.data( ), json_data3.size( ) );
+
+	auto fixed = daw::nativejson_alloc_reports{ };
+	alloc.release( );
+	{
+		auto const twitter_result =
+		  daw::json::from_json_alloc<daw::twitter::twitter_object_t>(
+		    json_sv1, daw::test_allocator( alloc ) );
+		fixed.twitter = daw::alloc_report( alloc );
+	}
+	alloc.release( );
+	{
+		auto const citm_result =
+		  daw::json::from_json_alloc<daw::citm::citm_object_t>(
+		    json_sv2, daw::test_allocator( alloc ) );
+		fixed.citm = daw::alloc_report( alloc );
+	}
+	alloc.release( );
+	{
+		auto const canada_result =
+		  daw::json::from_json_alloc<daw::geojson::Polygon>(
+		    json_sv3, "features[0].geometry", daw::test_allocator( alloc ) );
+		fixed.canada = daw::alloc_report( alloc );
+	}
+	alloc.release( );
+	auto const arena = daw::arena_alloc_reports( json_sv1, json_sv2, json_sv3 );
+
+	auto const print_row = []( char const *name,
+	                           daw::json_alloc_report const &fixed_report,
+	                           daw::json_alloc_report const &arena_report ) {
+		std::cout << name << "\n  fixed_allocator: ";
+		daw::print_alloc_stats( fixed_report );
+		std::cout << "\n  json_arena:      ";
+		daw::print_alloc_stats( arena_report );
+		std::cout << '\n';
+	};
+	std::cout << "Allocations\n*********************************************\n";
+	print_row( "twitter", fixed.twitter, arena.twitter );
+	print_row( "citm", fixed.citm, arena.citm );
+	print_row( "canada", fixed.canada, arena.canada );
+}
+#endif
+
 int main( int argc, char **argv )
 #if defined( DAW_USE_EXCEPTIONS )
   try
@@ -288,6 +352,9 @@ int main( int argc, char **argv )
 			test<ExecModeTypes::runtime>( argv, alloc );
 		}
 		test<ExecModeTypes::simd>( argv, alloc );
+#if not defined( DAW_JSON_TEST_ARENA )
+		compare_allocators( argv, alloc );
+#endif
 #if defined( DAW_USE_EXCEPTIONS )
 	} catch( daw::json::json_exception const &je ) {
 		std::cerr << "Unexpected error while testing: " << je.reason( ) << '\n';
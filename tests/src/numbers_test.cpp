@@ -85,6 +85,7 @@ int main( int argc, char **argv )
 #if defined( DAW_ALLOW_SSE42 )
 	test<daw::json::options::ExecModeTypes::simd>( sv_numbers );
 #endif
+	test<daw::json::options::ExecModeTypes::best_available>( sv_numbers );
 }
 #if defined( DAW_USE_EXCEPTIONS )
 catch( daw::json::json_exception const &jex ) {
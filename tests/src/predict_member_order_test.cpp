@@ -0,0 +1,159 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+// Parse with options::PredictMemberOrder when the member order of a class
+// changes, members are missing, duplicated or unmapped, and the same class is
+// nested in a different order.  Each result is compared to the default parse
+
+#include "defines.h"
+
+#include <daw/json/daw_json_link.h>
+
+#include <iostream>
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace tests {
+	struct point_t {
+		int x;
+		int y;
+		std::optional<int> z;
+
+		bool operator==( point_t const &rhs ) const {
+			return x == rhs.x and y == rhs.y and z == rhs.z;
+		}
+	};
+
+	struct line_t {
+		point_t first;
+		point_t last;
+
+		bool operator==( line_t const &rhs ) const {
+			return first == rhs.first and last == rhs.last;
+		}
+	};
+
+	struct tag_t {
+		std::optional<std::string> name;
+
+		bool operator==( tag_t const &rhs ) const {
+			return name == rhs.name;
+		}
+	};
+} // namespace tests
+
+namespace daw::json {
+	template<>
+	struct json_data_contract<tests::point_t> {
+		static constexpr char const x[] = "x";
+		static constexpr char const y[] = "y";
+		static constexpr char const z[] = "z";
+		using type = json_member_list<json_number<x, int>, json_number<y, int>,
+		                              json_number_null<z, std::optional<int>>>;
+	};
+
+	template<>
+	struct json_data_contract<tests::line_t> {
+		static constexpr char const first[] = "first";
+		static constexpr char const last[] = "last";
+		using type = json_member_list<json_class<first, tests::point_t>,
+		                              json_class<last, tests::point_t>>;
+	};
+
+	template<>
+	struct json_data_contract<tests::tag_t> {
+		static constexpr char const name[] = "name";
+		using type =
+		  json_member_list<json_string_null<name, std::optional<std::string>>>;
+	};
+} // namespace daw::json
+
+template<typename T>
+T parse_both( std::string_view json_doc ) {
+	using namespace daw::json;
+	auto const expected = from_json<T>( json_doc );
+	auto const predicted = from_json<T>(
+	  json_doc, options::parse_flags<options::PredictMemberOrder::yes> );
+	ensure( predicted == expected );
+	auto const predicted_unchecked = from_json<T>(
+	  json_doc, options::parse_flags<options::PredictMemberOrder::yes,
+	                                 options::CheckedParseMode::no> );
+	ensure( predicted_unchecked == expected );
+	return predicted;
+}
+
+int main( int, char ** )
+#if defined( DAW_USE_EXCEPTIONS )
+  try
+#endif
+{
+	using namespace daw::json;
+	using tests::point_t;
+
+	// The same order twice, so that the second parse hits the prediction
+	for( int n = 0; n < 2; ++n ) {
+		auto const p = parse_both<point_t>( R"({"z":3,"y":2,"x":1})" );
+		ensure( p.x == 1 and p.y == 2 and p.z == 3 );
+	}
+	// The prediction misses on the first member, then on the last
+	ensure( parse_both<point_t>( R"({"x":1,"y":2,"z":3})" ).x == 1 );
+	ensure( parse_both<point_t>( R"({"x":1,"y":2,"q":0,"z":3})" ).z == 3 );
+	// Fewer members than predicted, the missing nullable member is empty
+	ensure( not parse_both<point_t>( R"({"x":1,"y":2})" ).z );
+	ensure( parse_both<point_t>( R"({"x":1,"y":2,"z":3})" ).z == 3 );
+	// Unmapped members between the mapped ones are skipped
+	ensure( parse_both<point_t>(
+	          R"({"a":{"x":9},"y":2,"b":[1,{}],"x":1,"c":"x"})" )
+	          .x == 1 );
+	// A duplicate member uses the first one, like the default parser.  The
+	// recorded order then has the member twice
+	ensure( parse_both<point_t>( R"({"x":1,"y":2,"x":5})" ).x == 1 );
+	ensure( parse_both<point_t>( R"({"x":1,"y":2,"x":5})" ).x == 1 );
+	ensure( parse_both<point_t>( R"({"y":2,"x":1})" ).x == 1 );
+	// The same class nested in different orders replaces the prediction while
+	// the outer class is being parsed
+	for( int n = 0; n < 2; ++n ) {
+		auto const l = parse_both<tests::line_t>(
+		  R"({"last":{"y":4,"x":3},"first":{"x":1,"z":0,"y":2}})" );
+		ensure( l.first.x == 1 and l.first.z == 0 and l.last.x == 3 );
+	}
+	// Empty classes and a single nullable member
+	ensure( not parse_both<tests::tag_t>( "{}" ).name );
+	ensure( parse_both<tests::tag_t>( R"({"name":"a"})" ).name == "a" );
+	ensure( not parse_both<tests::tag_t>( R"({"name":null})" ).name );
+
+#if defined( DAW_USE_EXCEPTIONS )
+	auto const reason_of = []( std::string_view json_doc, auto flags ) {
+		try {
+			(void)from_json<point_t>( json_doc, flags );
+		} catch( json_exception const &jex ) { return jex.reason_type( ); }
+		return ErrorReason::Unknown;
+	};
+	// A missing member that is not nullable
+	ensure( reason_of( R"({"y":2})",
+	                   options::parse_flags<options::PredictMemberOrder::yes> ) ==
+	        ErrorReason::MemberNotFound );
+	// Unmapped members are an error with exact mappings
+	ensure( reason_of( R"({"y":2,"q":0,"x":1})",
+	                   options::parse_flags<
+	                     options::PredictMemberOrder::yes,
+	                     options::UseExactMappingsByDefault::yes> ) ==
+	        ErrorReason::UnknownMember );
+	// An unterminated class
+	ensure( reason_of( R"({"y":2,"x":1)",
+	                   options::parse_flags<options::PredictMemberOrder::yes> ) ==
+	        ErrorReason::UnexpectedEndOfData );
+#endif
+	std::cout << "done\n";
+}
+#if defined( DAW_USE_EXCEPTIONS )
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+}
+#endif
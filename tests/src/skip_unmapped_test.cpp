@@ -0,0 +1,143 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+// Skip arrays and classes in each exec mode.  The wide exec modes skip 64
+// bytes at a time, so strings, escapes and brackets are moved across the block
+// boundaries and the results are compared with the constexpr exec mode
+
+#include "defines.h"
+
+#include <daw/json/daw_json_link.h>
+
+#include <iostream>
+#include <string>
+
+namespace tests {
+	struct record_t {
+		int id;
+		std::string name;
+	};
+} // namespace tests
+
+namespace daw::json {
+	template<>
+	struct json_data_contract<tests::record_t> {
+		static constexpr char const id[] = "id";
+		static constexpr char const name[] = "name";
+		using type = json_member_list<json_number<id, int>, json_string<name>>;
+	};
+} // namespace daw::json
+
+template<daw::json::options::ExecModeTypes ExecMode>
+using policy_t = daw::json::BasicParsePolicy<
+  daw::json::options::parse_flags_t<ExecMode>::value>;
+
+template<daw::json::options::ExecModeTypes ExecMode>
+using unchecked_policy_t =
+  daw::json::BasicParsePolicy<daw::json::options::parse_flags_t<
+    ExecMode, daw::json::options::CheckedParseMode::no>::value>;
+
+// Skip the array or class at the start of json_doc and return the number of
+// top level commas.  The value must end right before the trailing "x"
+template<typename ParseState>
+std::size_t skip_value( std::string const &json_doc ) {
+	auto parse_state =
+	  ParseState( json_doc.data( ), json_doc.data( ) + json_doc.size( ) );
+	auto const result =
+	  json_doc.front( ) == '[' ? parse_state.skip_array( )
+	                           : parse_state.skip_class( );
+	ensure( *parse_state.first == 'x' );
+	return result.counter;
+}
+
+void check_skip( std::string const &value ) {
+	using daw::json::options::ExecModeTypes;
+	auto const json_doc = value + "x";
+	auto const expected =
+	  skip_value<policy_t<ExecModeTypes::compile_time>>( json_doc );
+	ensure( skip_value<policy_t<ExecModeTypes::runtime>>( json_doc ) ==
+	        expected );
+	ensure( skip_value<policy_t<ExecModeTypes::best_available>>( json_doc ) ==
+	        expected );
+	ensure( skip_value<unchecked_policy_t<ExecModeTypes::runtime>>(
+	          json_doc ) == expected );
+	ensure( skip_value<unchecked_policy_t<ExecModeTypes::best_available>>(
+	          json_doc ) == expected );
+}
+
+#if defined( DAW_USE_EXCEPTIONS )
+template<daw::json::options::ExecModeTypes ExecMode>
+daw::json::ErrorReason skip_error( std::string const &json_doc ) {
+	try {
+		(void)skip_value<policy_t<ExecMode>>( json_doc );
+	} catch( daw::json::json_exception const &jex ) {
+		return jex.reason_type( );
+	}
+	return daw::json::ErrorReason::Unknown;
+}
+
+void check_skip_error( std::string const &json_doc,
+                       daw::json::ErrorReason reason ) {
+	using daw::json::options::ExecModeTypes;
+	ensure( skip_error<ExecModeTypes::compile_time>( json_doc ) == reason );
+	ensure( skip_error<ExecModeTypes::runtime>( json_doc ) == reason );
+	ensure( skip_error<ExecModeTypes::best_available>( json_doc ) == reason );
+}
+#endif
+
+int main( int, char ** )
+#if defined( DAW_USE_EXCEPTIONS )
+  try
+#endif
+{
+	using namespace daw::json;
+	ensure( skip_value<policy_t<options::ExecModeTypes::best_available>>(
+	          "[1,[2,3],{\"a\":4,\"b\":5},6]x" ) == 3 );
+	check_skip( "[]" );
+	check_skip( "{}" );
+	check_skip( R"({"a":"]}\"[{,","b":"\\","c":[{"}":[]}]})" );
+
+	for( std::size_t pad = 0; pad < 130; ++pad ) {
+		auto const ws = std::string( pad, ' ' );
+		// Brackets and commas in strings, with escapes on either side of the
+		// block boundaries
+		check_skip( "[" + ws + R"("a\"],b",)" + ws + R"("\\\\",{"c":"{,"}])" );
+		check_skip( "{" + ws + R"("a":[1,"]"],"b":{"c":"\\\"}"},)" + ws +
+		            R"("d":2})" );
+		// Runs of backslashes that end at and across the block boundaries
+		check_skip( "[\"" + ws + std::string( 64, '\\' ) + "\",\"" +
+		            std::string( 63, '\\' ) + "\\],\"]" );
+		// The value closes in each position of a block
+		check_skip( "[" + ws + "[1,2],{\"a\":[3]}" + ws + "]" );
+		// Nested values deeper than a block is long
+		check_skip( "{\"a\":" + std::string( pad + 1, '[' ) + ws +
+		            std::string( pad + 1, ']' ) + ",\"b\":1}" );
+	}
+
+	// Unmapped members of every kind are skipped while looking for the mapped
+	// ones
+	auto const record = from_json<tests::record_t>(
+	  R"({"a":{"b":[1,"]}",{"c":"\\"}]},"d":[[],{}],"name":"n","id":1})",
+	  options::parse_flags<options::ExecModeTypes::best_available> );
+	ensure( record.id == 1 and record.name == "n" );
+
+#if defined( DAW_USE_EXCEPTIONS )
+	check_skip_error( "[1,2", ErrorReason::InvalidBracketing );
+	check_skip_error( "[1,{\"a\":2]}", ErrorReason::InvalidBracketing );
+	check_skip_error( "{\"a\":[1}]", ErrorReason::InvalidBracketing );
+	check_skip_error( "[\"abc]", ErrorReason::UnexpectedEndOfData );
+	check_skip_error( "[" + std::string( 100, ' ' ) + "\"a\\\"]",
+	                  ErrorReason::UnexpectedEndOfData );
+#endif
+	std::cout << "done\n";
+}
+#if defined( DAW_USE_EXCEPTIONS )
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+}
+#endif
@@ -121,6 +121,10 @@ int main( int argc, char **argv )
 		  test<daw::json::options::ExecModeTypes::simd>( json_string );
 		test_assert( h0 == h2, "constexpr/fast exec model hashes do not match" );
 	}
+	auto const h3 =
+	  test<daw::json::options::ExecModeTypes::best_available>( json_string );
+	test_assert( h0 == h3,
+	             "constexpr/best_available exec model hashes do not match" );
 }
 #if defined( DAW_USE_EXCEPTIONS )
 catch( daw::json::json_exception const &jex ) {
@@ -0,0 +1,124 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Skip arrays and classes with options::SkipWithStructuralIndex.  The index is
+// built before the document is changed so that the result shows which of the
+// index or the bytes were used
+
+#include "defines.h"
+
+#include <daw/json/daw_json_link.h>
+
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using indexed_policy_t = daw::json::BasicParsePolicy<
+  daw::json::options::parse_flags_t<
+    daw::json::options::SkipWithStructuralIndex::yes>::value>;
+
+using indexed_unchecked_policy_t = daw::json::BasicParsePolicy<
+  daw::json::options::parse_flags_t<
+    daw::json::options::SkipWithStructuralIndex::yes,
+    daw::json::options::CheckedParseMode::no>::value>;
+
+namespace tests {
+	struct id_t {
+		int id;
+	};
+} // namespace tests
+
+namespace daw::json {
+	template<>
+	struct json_data_contract<tests::id_t> {
+		static constexpr char const id[] = "id";
+		using type = json_member_list<json_number<id, int>>;
+	};
+} // namespace daw::json
+
+template<typename ParseState>
+std::size_t skip_stale_array( bool use_index ) {
+	auto doc = std::string( R"([1,"a,b",[2,3],{"c":4},5])" );
+	auto const index = daw::json::json_details::json_structural_index(
+	  doc.data( ), doc.data( ) + doc.size( ) );
+	// Only the commas between the elements of the outer array are counted
+	for( auto &c : doc ) {
+		if( c == ',' ) {
+			c = ' ';
+		}
+	}
+	auto parse_state = ParseState( doc.data( ), doc.data( ) + doc.size( ) );
+	if( use_index ) {
+		parse_state.structural_index = &index;
+	}
+	++parse_state.first;
+	auto const result = parse_state.skip_array( );
+	ensure( parse_state.first == doc.data( ) + doc.size( ) );
+	return result.counter;
+}
+
+#if defined( DAW_USE_EXCEPTIONS )
+template<typename ParseState>
+bool skip_unterminated( std::string doc, std::size_t range_size ) {
+	auto const index = daw::json::json_details::json_structural_index(
+	  doc.data( ), doc.data( ) + doc.size( ) );
+	auto parse_state = ParseState( doc.data( ), doc.data( ) + range_size );
+	parse_state.structural_index = &index;
+	++parse_state.first;
+	try {
+		(void)parse_state.skip_array( );
+	} catch( daw::json::json_exception const &jex ) {
+		return jex.reason_type( ) == daw::json::ErrorReason::UnexpectedEndOfData;
+	}
+	return false;
+}
+#endif
+
+int main( int, char ** )
+#if defined( DAW_USE_EXCEPTIONS )
+  try
+#endif
+{
+	using namespace daw::json;
+	ensure( skip_stale_array<indexed_policy_t>( true ) == 4 );
+	ensure( skip_stale_array<indexed_policy_t>( false ) == 0 );
+	ensure( skip_stale_array<indexed_unchecked_policy_t>( true ) == 4 );
+
+#if defined( DAW_USE_EXCEPTIONS )
+	// The string is the last entry in the index
+	ensure( skip_unterminated<indexed_policy_t>( R"([1,"abc])", 8 ) );
+	// The range ends in a string that is closed later in the document
+	ensure( skip_unterminated<indexed_policy_t>( R"(["abc",1])", 4 ) );
+	{
+		bool has_error = false;
+		try {
+			(void)from_json<tests::id_t>(
+			  R"({"id":1,"unmapped":["abc]})",
+			  options::parse_flags<options::SkipWithStructuralIndex::yes> );
+		} catch( json_exception const & ) { has_error = true; }
+		ensure( has_error );
+	}
+#endif
+
+	// from_json_array skips the unmapped members with the index
+	std::string const json_doc =
+	  R"({"items":[{"a":"]\"}","id":1},{"b":[{"}":1}],"id":2}]})";
+	auto const items = from_json_array<tests::id_t>(
+	  json_doc, "items",
+	  options::parse_flags<options::SkipWithStructuralIndex::yes> );
+	ensure( items.size( ) == 2 and items[0].id == 1 and items[1].id == 2 );
+	auto const root_items = from_json_array<tests::id_t>(
+	  std::string_view( json_doc ).substr( 9, json_doc.size( ) - 10 ),
+	  options::parse_flags<options::SkipWithStructuralIndex::yes> );
+	ensure( root_items.size( ) == 2 and root_items[1].id == 2 );
+	std::cout << "done\n";
+}
+#if defined( DAW_USE_EXCEPTIONS )
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+}
+#endif
@@ -13,6 +13,7 @@
 #include <daw/daw_benchmark.h>
 
 #include <iostream>
+#include <string>
 #include <string_view>
 
 bool test_empty( ) {
@@ -140,6 +141,20 @@ bool test_escaped_quote_004( ) {
 	return v.size( ) == 66;
 }
 
+// The escaped quote straddles the 64 byte blocks used by the wide kernels
+template<daw::json::options::ExecModeTypes ExecMode>
+bool test_escaped_quote_005( ) {
+	std::string const str = '"' + std::string( 63, 'a' ) + R"(\")" +
+	                        std::string( 70, 'b' ) + R"(\\")" +
+	                        std::string( 64, ' ' );
+	using namespace daw::json;
+	using namespace daw::json::json_details;
+	auto rng = BasicParsePolicy<parse_options( ExecMode )>(
+	  std::data( str ), daw::data_end( str ) );
+	auto v = skip_string( rng );
+	return v.size( ) == 137;
+}
+
 #define do_test( ... )                                                 \
 	try {                                                                \
 		if( not( __VA_ARGS__ ) ) {                                         \
@@ -189,6 +204,34 @@ int main( int, char ** )
 	  test_escaped_quote_003<daw::json::options::ExecModeTypes::runtime>( ) );
 	do_test(
 	  test_escaped_quote_004<daw::json::options::ExecModeTypes::runtime>( ) );
+	do_test(
+	  test_escaped_quote_005<daw::json::options::ExecModeTypes::runtime>( ) );
+	do_test( test_escaped_quote_001<
+	         daw::json::options::ExecModeTypes::best_available>( ) );
+	do_test( test_escaped_quote_002<
+	         daw::json::options::ExecModeTypes::best_available>( ) );
+	do_test( test_escaped_quote_003<
+	         daw::json::options::ExecModeTypes::best_available>( ) );
+	do_test( test_escaped_quote_004<
+	         daw::json::options::ExecModeTypes::best_available>( ) );
+	do_test( test_escaped_quote_005<
+	         daw::json::options::ExecModeTypes::best_available>( ) );
+#if defined( DAW_JSON_HAS_RUNTIME_CPU_DISPATCH )
+	if( daw::json::json_details::best_simd_level( ) >=
+	    daw::json::json_details::simd_level::avx2 ) {
+		do_test(
+		  test_escaped_quote_004<daw::json::options::ExecModeTypes::avx2>( ) );
+		do_test(
+		  test_escaped_quote_005<daw::json::options::ExecModeTypes::avx2>( ) );
+	}
+	if( daw::json::json_details::best_simd_level( ) ==
+	    daw::json::json_details::simd_level::avx512 ) {
+		do_test(
+		  test_escaped_quote_004<daw::json::options::ExecModeTypes::avx512>( ) );
+		do_test(
+		  test_escaped_quote_005<daw::json::options::ExecModeTypes::avx512>( ) );
+	}
+#endif
 #if defined( DAW_ALLOW_SSE42 )
 	do_test( test_escaped_quote_001<daw::json::options::ExecModeTypes::simd>( ) );
 	do_test( test_escaped_quote_002<daw::json::options::ExecModeTypes::simd>( ) );
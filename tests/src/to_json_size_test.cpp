@@ -0,0 +1,144 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+// Check that to_json_size is the exact size of the to_json output and that
+// to_json_exact writes the same output, with escapes, numbers of different
+// widths and pretty printing.  A span that is too small must fail before it
+// is overrun
+
+#include "defines.h"
+
+#include <daw/daw_span.h>
+#include <daw/json/daw_json_link.h>
+
+#include <cstdint>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <optional>
+#include <string>
+#include <tuple>
+#include <vector>
+
+struct Inner {
+	std::string name;
+	std::optional<double> value;
+};
+
+struct Outer {
+	std::int64_t id;
+	bool flag;
+	std::vector<Inner> items;
+	std::map<std::string, int> counts;
+};
+
+namespace daw::json {
+	template<>
+	struct json_data_contract<Inner> {
+		static constexpr char const name[] = "name";
+		static constexpr char const value[] = "value";
+		using type = json_member_list<json_link<name, std::string>,
+		                              json_link<value, std::optional<double>>>;
+
+		static constexpr auto to_json_data( Inner const &v ) {
+			return std::forward_as_tuple( v.name, v.value );
+		}
+	};
+
+	template<>
+	struct json_data_contract<Outer> {
+		static constexpr char const id[] = "id";
+		static constexpr char const flag[] = "flag";
+		static constexpr char const items[] = "items";
+		static constexpr char const counts[] = "counts";
+		using type =
+		  json_member_list<json_link<id, std::int64_t>, json_link<flag, bool>,
+		                   json_link<items, std::vector<Inner>>,
+		                   json_link<counts, std::map<std::string, int>>>;
+
+		static constexpr auto to_json_data( Outer const &v ) {
+			return std::forward_as_tuple( v.id, v.flag, v.items, v.counts );
+		}
+	};
+} // namespace daw::json
+
+template<typename Value, typename Flags>
+void check_value( Value const &value, Flags flags ) {
+	auto const expected = daw::json::to_json( value, flags );
+	ensure( daw::json::to_json_size( value, flags ) == expected.size( ) );
+	auto const exact = daw::json::to_json_exact( value, flags );
+	ensure( exact == expected );
+#if defined( DAW_USE_EXCEPTIONS )
+	// A span one byte short is an error before it is overrun
+	auto buffer = std::string( expected.size( ) + 1U, '#' );
+	auto reason = daw::json::ErrorReason::Unknown;
+	try {
+		(void)daw::json::to_json(
+		  value, daw::span<char>( buffer.data( ), expected.size( ) - 1U ), flags );
+	} catch( daw::json::json_exception const &jex ) {
+		reason = jex.reason_type( );
+	}
+	ensure( reason == daw::json::ErrorReason::OutputError );
+	ensure( buffer.substr( expected.size( ) - 1U ) == "##" );
+#endif
+}
+
+template<typename Container, typename Flags>
+void check_array( Container const &c, Flags flags ) {
+	auto const expected = daw::json::to_json_array( c, flags );
+	ensure( daw::json::to_json_array_size( c, flags ) == expected.size( ) );
+	ensure( daw::json::to_json_array_exact( c, flags ) == expected );
+}
+
+template<typename Flags>
+void check_all( Flags flags ) {
+	auto outers = std::vector<Outer>( );
+	for( int n = 0; n < 100; ++n ) {
+		auto outer =
+		  Outer{ n % 2 == 0 ? n * 1'000'003LL : -n, n % 3 == 0, { }, { } };
+		for( int i = 0; i < n % 5; ++i ) {
+			auto inner = Inner{ "item \"" + std::to_string( i ) + "\"\n\t\\ \x01",
+			                    std::nullopt };
+			if( i % 2 == 0 ) {
+				inner.value = 1.0 / ( i + n + 1 );
+			}
+			outer.items.push_back( inner );
+		}
+		outer.counts["key " + std::to_string( n )] = n * n;
+		outers.push_back( outer );
+	}
+	outers.back( ).id = std::numeric_limits<std::int64_t>::min( );
+
+	check_value( outers.front( ), flags );
+	check_value( outers, flags );
+	check_array( outers, flags );
+	check_array( std::vector<double>{ 0.0, -1.5, 1e300, 5e-324, 123456.789 },
+	             flags );
+	check_value( std::string( "\xc3\xa9\xe2\x82\xac \x7f \"\\/" ), flags );
+	check_value( 42, flags );
+}
+
+int main( )
+#if defined( DAW_USE_EXCEPTIONS )
+  try
+#endif
+{
+	using namespace daw::json::options;
+	check_all( output_flags<> );
+	check_all( output_flags<SerializationFormat::Pretty> );
+	check_all(
+	  output_flags<SerializationFormat::Pretty, IndentationType::Space3,
+	               NewLineDelimiter::rn, OutputTrailingComma::Yes> );
+	check_all( output_flags<RestrictedStringOutput::OnlyAllow7bitsStrings> );
+	std::cout << "done\n";
+}
+#if defined( DAW_USE_EXCEPTIONS )
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+}
+#endif
@@ -14,8 +14,11 @@
 #include <daw/daw_read_file.h>
 #include <daw/daw_traits.h>
 #include <daw/json/daw_from_json.h>
+#include <daw/json/daw_json_buffered_output.h>
 #include <daw/json/daw_to_json.h>
 
+#include <cstdio>
+#include <fstream>
 #include <iostream>
 #include <streambuf>
 
@@ -69,6 +72,73 @@ int main( int argc, char **argv )
 	auto const twitter_result2 =
 	  daw::json::from_json<daw::twitter::twitter_object_t>( str );
 	daw::do_not_optimize( twitter_result2 );
+
+	// ******************************
+	// Serialization to files
+	auto const read_back = []( std::FILE *f ) {
+		auto result = std::string( );
+		std::rewind( f );
+		char buffer[4096];
+		std::size_t count = 0;
+		while( ( count = std::fread( buffer, 1, sizeof( buffer ), f ) ) > 0 ) {
+			result.append( buffer, count );
+		}
+		return result;
+	};
+	std::FILE *out_file = std::tmpfile( );
+	test_assert( out_file != nullptr, "Unable to create a temporary file" );
+	(void)daw::bench_n_test_mbs<DAW_NUM_RUNS>(
+	  "twitter bench(to_json FILE *)", sz,
+	  [&]( auto const &tr ) {
+		  std::rewind( out_file );
+		  daw::json::to_json( *tr, out_file );
+		  std::fflush( out_file );
+	  },
+	  twitter_result );
+	test_assert( read_back( out_file ) == str, "Unexpected FILE * output" );
+
+	{
+		auto const path = std::string( "twitter_output_test.json" );
+		auto out_stream = std::ofstream( path, std::ios::binary );
+		(void)daw::bench_n_test_mbs<DAW_NUM_RUNS>(
+		  "twitter bench(to_json ostream)", sz,
+		  [&]( auto const &tr ) {
+			  out_stream.seekp( 0 );
+			  daw::json::to_json( *tr, out_stream );
+			  out_stream.flush( );
+		  },
+		  twitter_result );
+		out_stream.close( );
+		std::remove( path.c_str( ) );
+	}
+
+	(void)daw::bench_n_test_mbs<DAW_NUM_RUNS>(
+	  "twitter bench(to_json json_buffered_output FILE *)", sz,
+	  [&]( auto const &tr ) {
+		  std::rewind( out_file );
+		  auto out = daw::json::json_buffered_output( out_file );
+		  daw::json::to_json( *tr, out );
+		  out.flush( );
+	  },
+	  twitter_result );
+	test_assert( read_back( out_file ) == str,
+	             "Unexpected json_buffered_output FILE * output" );
+
+#if defined( DAW_JSON_HAS_FD_STREAMS )
+	int const out_fd = ::fileno( out_file );
+	(void)daw::bench_n_test_mbs<DAW_NUM_RUNS>(
+	  "twitter bench(to_json json_buffered_output fd)", sz,
+	  [&]( auto const &tr ) {
+		  (void)::lseek( out_fd, 0, SEEK_SET );
+		  auto out = daw::json::json_buffered_output( out_fd );
+		  daw::json::to_json( *tr, out );
+		  out.flush( );
+	  },
+	  twitter_result );
+	test_assert( read_back( out_file ) == str,
+	             "Unexpected json_buffered_output fd output" );
+#endif
+	std::fclose( out_file );
 }
 #if defined( DAW_USE_EXCEPTIONS )
 catch( daw::json::json_exception const &jex ) {
@@ -58,6 +58,23 @@ inline namespace {
 			             "Missing value" );
 		}
 
+		// options::MemberNameMatching::length_and_bytes
+		(void)daw::json::benchmark::benchmark(
+		  DAW_NUM_RUNS, sz, "twitter bench(checked, length_and_bytes names)",
+		  [&twitter_result]( auto f1 ) {
+			  twitter_result = daw::json::from_json<daw::twitter::twitter_object_t>(
+			    f1, parse_flags<ExecMode, MemberNameMatching::length_and_bytes> );
+			  daw::do_not_optimize( twitter_result );
+		  },
+		  json_data );
+		daw::do_not_optimize( twitter_result );
+		if( do_asserts ) {
+			test_assert( twitter_result, "Missing value" );
+			test_assert( not twitter_result->statuses.empty( ), "Expected values" );
+			test_assert( twitter_result->statuses.front( ).user.id == 1186275104,
+			             "Missing value" );
+		}
+
 		// options::CheckedParseMode::no
 		(void)daw::json::benchmark::benchmark(
 		  DAW_NUM_RUNS, sz, "twitter bench(unchecked)",
@@ -248,6 +265,23 @@ int main( int argc, char **argv )
 	auto const twitter_result2 =
 	  daw::json::from_json<daw::twitter::twitter_object_t>( str );
 	daw::do_not_optimize( twitter_result2 );
+
+	// The same document minified and pretty printed.  The difference is the
+	// cost of skipping whitespace
+	auto const pretty = daw::json::to_json(
+	  *twitter_result, output_flags<SerializationFormat::Pretty> );
+	auto const bench_parse = []( char const *title, std::string_view doc ) {
+		(void)daw::json::benchmark::benchmark(
+		  DAW_NUM_RUNS, doc.size( ), title,
+		  []( auto f1 ) {
+			  auto r = daw::json::from_json<daw::twitter::twitter_object_t>(
+			    f1, parse_flags<ExecModeTypes::best_available> );
+			  daw::do_not_optimize( r );
+		  },
+		  doc );
+	};
+	bench_parse( "twitter bench(minified)", str );
+	bench_parse( "twitter bench(pretty)", pretty );
 }
 #if defined( DAW_USE_EXCEPTIONS )
 catch( daw::json::json_exception const &jex ) {
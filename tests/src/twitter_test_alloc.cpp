@@ -9,6 +9,7 @@
 #include "defines.h"
 
 #include "daw/json/daw_json_link.h"
+#include "json_test_alloc.h"
 #include "twitter_test_alloc_json.h"
 
 #include <daw/cpp_17.h>
@@ -44,7 +45,11 @@ DAW_CONSTEXPR bool operator==( T const &lhs, T const &rhs ) {
 	return true;
 }
 
+#if defined( DAW_JSON_TEST_ARENA )
+using AllocType = daw::json::json_arena;
+#else
 using AllocType = daw::fixed_allocator<daw::twitter::twitter_object_t>;
+#endif
 using namespace daw::json::options;
 
 template<ExecModeTypes ExecMode>
@@ -65,11 +70,11 @@ void test( std::string_view json_data, AllocType &alloc )
 		  alloc.release( );
 		  twitter_result =
 		    daw::json::from_json_alloc<daw::twitter::twitter_object_t>(
-		      f1, alloc, parse_flags<ExecMode> );
+		      f1, daw::test_allocator( alloc ), parse_flags<ExecMode> );
 		  daw::do_not_optimize( twitter_result );
 	  },
 	  json_data );
-	std::cout << "Total Allocations: " << alloc.used( ) << " bytes\n";
+	daw::print_alloc_stats( alloc );
 	daw::do_not_optimize( twitter_result );
 	test_assert( twitter_result, "Missing value" );
 	test_assert( not twitter_result->statuses.empty( ), "Expected values" );
@@ -84,11 +89,12 @@ void test( std::string_view json_data, AllocType &alloc )
 		  alloc.release( );
 		  twitter_result =
 		    daw::json::from_json_alloc<daw::twitter::twitter_object_t>(
-		      f1, alloc, parse_flags<ExecMode, CheckedParseMode::no> );
+		      f1, daw::test_allocator( alloc ),
+		      parse_flags<ExecMode, CheckedParseMode::no> );
 		  daw::do_not_optimize( twitter_result );
 	  },
 	  json_data );
-	std::cout << "Total Allocations: " << alloc.used( ) << " bytes\n";
+	daw::print_alloc_stats( alloc );
 	daw::do_not_optimize( twitter_result );
 	test_assert( twitter_result, "Missing value" );
 	test_assert( not twitter_result->statuses.empty( ), "Expected values" );
@@ -103,11 +109,12 @@ void test( std::string_view json_data, AllocType &alloc )
 		  alloc.release( );
 		  twitter_result =
 		    daw::json::from_json_alloc<daw::twitter::twitter_object_t>(
-		      f1, alloc, parse_flags<ExecMode, PolicyCommentTypes::cpp> );
+		      f1, daw::test_allocator( alloc ),
+		      parse_flags<ExecMode, PolicyCommentTypes::cpp> );
 		  daw::do_not_optimize( twitter_result );
 	  },
 	  json_data );
-	std::cout << "Total Allocations: " << alloc.used( ) << " bytes\n";
+	daw::print_alloc_stats( alloc );
 	daw::do_not_optimize( twitter_result );
 	test_assert( twitter_result, "Missing value" );
 	test_assert( not twitter_result->statuses.empty( ), "Expected values" );
@@ -122,13 +129,13 @@ void test( std::string_view json_data, AllocType &alloc )
 		  alloc.release( );
 		  twitter_result =
 		    daw::json::from_json_alloc<daw::twitter::twitter_object_t>(
-		      f1, alloc,
+		      f1, daw::test_allocator( alloc ),
 		      parse_flags<ExecMode, PolicyCommentTypes::cpp,
 		                  CheckedParseMode::no> );
 		  daw::do_not_optimize( twitter_result );
 	  },
 	  json_data );
-	std::cout << "Total Allocations: " << alloc.used( ) << " bytes\n";
+	daw::print_alloc_stats( alloc );
 	daw::do_not_optimize( twitter_result );
 	test_assert( twitter_result, "Missing value" );
 	test_assert( not twitter_result->statuses.empty( ), "Expected values" );
@@ -143,11 +150,12 @@ void test( std::string_view json_data, AllocType &alloc )
 		  alloc.release( );
 		  twitter_result =
 		    daw::json::from_json_alloc<daw::twitter::twitter_object_t>(
-		      f1, alloc, parse_flags<ExecMode, PolicyCommentTypes::hash> );
+		      f1, daw::test_allocator( alloc ),
+		      parse_flags<ExecMode, PolicyCommentTypes::hash> );
 		  daw::do_not_optimize( twitter_result );
 	  },
 	  json_data );
-	std::cout << "Total Allocations: " << alloc.used( ) << " bytes\n";
+	daw::print_alloc_stats( alloc );
 	daw::do_not_optimize( twitter_result );
 	test_assert( twitter_result, "Missing value" );
 	test_assert( not twitter_result->statuses.empty( ), "Expected values" );
@@ -162,13 +170,13 @@ void test( std::string_view json_data, AllocType &alloc )
 		  alloc.release( );
 		  twitter_result =
 		    daw::json::from_json_alloc<daw::twitter::twitter_object_t>(
-		      f1, alloc,
+		      f1, daw::test_allocator( alloc ),
 		      parse_flags<ExecMode, PolicyCommentTypes::hash,
 		                  CheckedParseMode::no> );
 		  daw::do_not_optimize( twitter_result );
 	  },
 	  json_data );
-	std::cout << "Total Allocations: " << alloc.used( ) << " bytes\n";
+	daw::print_alloc_stats( alloc );
 	daw::do_not_optimize( twitter_result );
 	test_assert( twitter_result, "Missing value" );
 	test_assert( not twitter_result->statuses.empty( ), "Expected values" );
@@ -184,11 +192,12 @@ void test( std::string_view json_data, AllocType &alloc )
 		  alloc.release( );
 		  twitter_result =
 		    daw::json::from_json_alloc<daw::twitter::twitter_object_t>(
-		      f1, alloc, parse_flags<ExecMode, AllowEscapedNames::yes> );
+		      f1, daw::test_allocator( alloc ),
+		      parse_flags<ExecMode, AllowEscapedNames::yes> );
 		  daw::do_not_optimize( twitter_result );
 	  },
 	  json_data );
-	std::cout << "Total Allocations: " << alloc.used( ) << " bytes\n";
+	daw::print_alloc_stats( alloc );
 	daw::do_not_optimize( twitter_result );
 	test_assert( twitter_result, "Missing value" );
 	test_assert( not twitter_result->statuses.empty( ), "Expected values" );
@@ -203,12 +212,12 @@ void test( std::string_view json_data, AllocType &alloc )
 		  alloc.release( );
 		  twitter_result =
 		    daw::json::from_json_alloc<daw::twitter::twitter_object_t>(
-		      f1, alloc,
+		      f1, daw::test_allocator( alloc ),
 		      parse_flags<ExecMode, AllowEscapedNames::yes, CheckedParseMode::no> );
 		  daw::do_not_optimize( twitter_result );
 	  },
 	  json_data );
-	std::cout << "Total Allocations: " << alloc.used( ) << " bytes\n";
+	daw::print_alloc_stats( alloc );
 	daw::do_not_optimize( twitter_result );
 	test_assert( twitter_result, "Missing value" );
 	test_assert( not twitter_result->statuses.empty( ), "Expected values" );
@@ -262,9 +271,9 @@ int main( int argc, char **argv )
 	std::string str{ };
 	{
 		auto twitter_result =
-		  daw::json::from_json_alloc<daw::twitter::twitter_object_t>( json_data,
-		                                                              alloc );
-		std::cout << "Total Allocations: " << alloc.used( ) << " bytes\n";
+		  daw::json::from_json_alloc<daw::twitter::twitter_object_t>(
+		    json_data, daw::test_allocator( alloc ) );
+		daw::print_alloc_stats( alloc );
 		(void)daw::bench_n_test_mbs<DAW_NUM_RUNS>(
 		  "twitter bench(to_json_string)", sz,
 		  [&]( auto const &tr ) {
@@ -278,7 +287,8 @@ int main( int argc, char **argv )
 	}
 	alloc.release( );
 	auto const twitter_result2 =
-	  daw::json::from_json_alloc<daw::twitter::twitter_object_t>( str, alloc );
+	  daw::json::from_json_alloc<daw::twitter::twitter_object_t>(
+	    str, daw::test_allocator( alloc ) );
 	daw::do_not_optimize( twitter_result2 );
 }
 #if defined( DAW_USE_EXCEPTIONS )
@@ -0,0 +1,69 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+// Each DAW_JSON_COMPILE_FAIL_CASE uses options::UnescapeInPlace with an entry
+// point that cannot decode in place and must fail to compile
+
+#include <daw/json/daw_json_file.h>
+#include <daw/json/daw_json_link.h>
+#include <daw/json/daw_json_push_parser.h>
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+#if not defined( DAW_JSON_COMPILE_FAIL_CASE )
+#error DAW_JSON_COMPILE_FAIL_CASE must be defined
+#endif
+
+int main( ) {
+	using namespace daw::json;
+	std::string json_doc = R"(["a\tb","c"])";
+	std::string_view const json_view = json_doc;
+	(void)json_view;
+#if DAW_JSON_COMPILE_FAIL_CASE == 1
+	// A read only document
+	auto result = from_json<std::vector<std::string_view>>(
+	  json_view, options::parse_flags<options::UnescapeInPlace::yes> );
+	(void)result;
+#elif DAW_JSON_COMPILE_FAIL_CASE == 2
+	// Dereferencing a json_array_iterator parses the element again
+	using range_t =
+	  json_array_range<std::string_view, options::UnescapeInPlace::yes>;
+	for( auto s : range_t( json_doc ) ) {
+		(void)s;
+	}
+#elif DAW_JSON_COMPILE_FAIL_CASE == 3
+	using range_t =
+	  json_lines_range<std::string_view, options::UnescapeInPlace::yes>;
+	for( auto s : range_t( json_doc ) ) {
+		(void)s;
+	}
+#elif DAW_JSON_COMPILE_FAIL_CASE == 4
+	// The file is mapped read only
+	auto range =
+	  json_array_range_file<std::string_view, options::UnescapeInPlace::yes>(
+	    "unescape_in_place_compile_fail.json" );
+	(void)range;
+#elif DAW_JSON_COMPILE_FAIL_CASE == 5
+	auto jv = basic_json_value<
+	  options::parse_flags_t<options::UnescapeInPlace::yes>::value>( json_view );
+	(void)jv;
+#elif DAW_JSON_COMPILE_FAIL_CASE == 6
+	auto parser =
+	  json_push_parser<std::string_view, options::UnescapeInPlace::yes>( );
+	(void)parser;
+#elif DAW_JSON_COMPILE_FAIL_CASE == 7
+	// A read only view of a mutable buffer
+	auto range =
+	  json_array_range_once<std::string_view, options::UnescapeInPlace::yes>(
+	    json_view );
+	(void)range;
+#else
+#error Unknown DAW_JSON_COMPILE_FAIL_CASE
+#endif
+}
@@ -0,0 +1,144 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+// Parse strings with escapes using options::UnescapeInPlace and check that
+// raw members refer to the decoded bytes
+
+#include "defines.h"
+
+#include <daw/json/daw_json_link.h>
+
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace tests {
+	struct item_t {
+		std::string_view key;
+		std::string value;
+		std::vector<std::string_view> tags;
+	};
+} // namespace tests
+
+namespace daw::json {
+	template<>
+	struct json_data_contract<tests::item_t> {
+		static constexpr char const key[] = "key";
+		static constexpr char const value[] = "value";
+		static constexpr char const tags[] = "tags";
+		using type = json_member_list<
+		  json_string_raw<key, std::string_view>, json_string<value>,
+		  json_array<tags, json_string_raw_no_name<std::string_view>>>;
+	};
+} // namespace daw::json
+
+#if defined( DAW_USE_EXCEPTIONS )
+// Invalid strings have the same result in place as with the default parse
+template<typename Flags>
+void check_same_outcome( std::string json_doc, Flags flags ) {
+	using namespace daw::json;
+	auto expected = std::vector<std::string>( );
+	auto expected_reason = ErrorReason::Unknown;
+	try {
+		expected = from_json<std::vector<std::string>>( json_doc );
+	} catch( json_exception const &jex ) { expected_reason = jex.reason_type( ); }
+	auto result = std::vector<std::string>( );
+	auto reason = ErrorReason::Unknown;
+	try {
+		result = from_json<std::vector<std::string>>( json_doc, flags );
+	} catch( json_exception const &jex ) { reason = jex.reason_type( ); }
+	test_assert( reason == expected_reason and result == expected,
+	             "In place result differs from the default parse" );
+}
+#endif
+
+int main( int, char ** )
+#if defined( DAW_USE_EXCEPTIONS )
+  try
+#endif
+{
+	using namespace daw::json;
+	// The tags member is first so that key and value are parsed from their
+	// stored locations
+	std::string json_doc =
+	  R"([{"tags":["a\tb","plain","\u00e9\ud83d\ude00"],"value":"x\"y\\z\/",)"
+	  R"("key":"line\nbreak"},{"key":"no escapes","value":"","tags":[]}])";
+	auto const expected =
+	  from_json<std::vector<tests::item_t>>( std::string( json_doc ) );
+	auto const result = from_json<std::vector<tests::item_t>>(
+	  json_doc, options::parse_flags<options::UnescapeInPlace::yes> );
+
+	test_assert( result.size( ) == 2, "Unexpected number of items" );
+	test_assert( result[0].key == "line\nbreak", "key was not decoded" );
+	test_assert( result[0].value == expected[0].value,
+	             "value does not match the default parse" );
+	test_assert( result[0].value == "x\"y\\z/", "value was not decoded" );
+	test_assert( result[0].tags.size( ) == 3, "Unexpected tag count" );
+	test_assert( result[0].tags[0] == "a\tb", "tag was not decoded" );
+	test_assert( result[0].tags[1] == "plain", "tag was changed" );
+	test_assert( result[0].tags[2] == "\xC3\xA9\xF0\x9F\x98\x80",
+	             "unicode escapes were not decoded" );
+	test_assert( result[1].key == "no escapes", "key was changed" );
+	test_assert( result[1].value.empty( ) and result[1].tags.empty( ),
+	             "Expected empty members" );
+	// The views refer to the document
+	test_assert( result[0].key.data( ) >= json_doc.data( ) and
+	               result[0].key.data( ) < json_doc.data( ) + json_doc.size( ),
+	             "key does not refer to the document" );
+
+	std::string json_doc_unchecked =
+	  R"({"key":"\"quoted\"","value":"\\","tags":["\\n"]})";
+	auto const result_unchecked = from_json<tests::item_t>(
+	  json_doc_unchecked, options::parse_flags<options::UnescapeInPlace::yes,
+	                                           options::CheckedParseMode::no> );
+	test_assert( result_unchecked.key == "\"quoted\"",
+	             "unchecked key was not decoded" );
+	test_assert( result_unchecked.value == "\\",
+	             "unchecked value was not decoded" );
+	test_assert( result_unchecked.tags.size( ) == 1 and
+	               result_unchecked.tags[0] == "\\n",
+	             "unchecked tag was not decoded" );
+
+	// json_array_range_once parses each element once, so it can decode the
+	// elements of a mutable buffer in place
+	std::string json_array_doc = R"([{"key":"a\/b","value":"\u0041",)"
+	                             R"("tags":["\"\""]},{"key":"c\\",)"
+	                             R"("value":"d","tags":[]}])";
+	auto items = std::vector<tests::item_t>( );
+	for( tests::item_t const &item :
+	     json_array_range_once<tests::item_t, options::UnescapeInPlace::yes>(
+	       json_array_doc ) ) {
+		items.push_back( item );
+	}
+	test_assert( items.size( ) == 2, "Unexpected number of range items" );
+	test_assert( items[0].key == "a/b" and items[0].value == "A" and
+	               items[0].tags.size( ) == 1 and items[0].tags[0] == "\"\"",
+	             "range element was not decoded" );
+	test_assert( items[1].key == "c\\" and items[1].value == "d",
+	             "range element was not decoded" );
+	test_assert( items[0].key.data( ) >= json_array_doc.data( ) and
+	               items[0].key.data( ) <
+	                 json_array_doc.data( ) + json_array_doc.size( ),
+	             "range key does not refer to the document" );
+
+#if defined( DAW_USE_EXCEPTIONS )
+	for( std::string_view json_doc :
+	     { R"(["\q"])", R"(["\u00"])", R"(["\u00zz"])", R"(["\ud83d"])",
+	       R"(["\ud83dx"])", R"(["\ude00"])", R"(["abc\"])", R"(["\)" } ) {
+		check_same_outcome( std::string( json_doc ),
+		                    options::parse_flags<options::UnescapeInPlace::yes> );
+	}
+#endif
+	std::cout << "Decoded strings in place\n";
+}
+#if defined( DAW_USE_EXCEPTIONS )
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+}
+#endif
@@ -0,0 +1,111 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+// Parse strings with options::ValidateUTF8 in each exec mode.  Well-formed
+// multibyte sequences are accepted and malformed ones are rejected wherever
+// they are in the string
+
+#include "defines.h"
+
+#include <daw/json/daw_json_link.h>
+
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include <vector>
+
+template<daw::json::options::ExecModeTypes ExecMode,
+         daw::json::options::CheckedParseMode Checked>
+void test_validate_utf8( ) {
+	using namespace daw::json;
+	static constexpr auto flags =
+	  options::parse_flags<options::ValidateUTF8::yes, ExecMode, Checked>;
+
+	std::string const valid =
+	  "[\"plain\", \"caf\xC3\xA9 \xE2\x82\xAC \xF0\x9F\x98\x80 \\n\", \"\"]";
+	auto const values = from_json<std::vector<std::string>>( valid, flags );
+	test_assert( values.size( ) == 3 and values[0] == "plain" and
+	               values[1] == "caf\xC3\xA9 \xE2\x82\xAC \xF0\x9F\x98\x80 \n" and
+	               values[2].empty( ),
+	             "Unexpected strings" );
+
+	// Move the sequence across the 64 byte blocks of the scanner
+	for( std::size_t pos = 0; pos < 140; ++pos ) {
+		for( char const *good : { "\xC3\xA9", "\xED\x9F\xBF", "\xF0\x9F\x98\x80",
+		                          "\xF4\x8F\xBF\xBF" } ) {
+			auto str = std::string( 140, 'a' );
+			str.replace( pos, 1, good );
+			test_assert( from_json<std::string>( "\"" + str + "\"", flags ) == str,
+			             "Unexpected multibyte string" );
+		}
+#if defined( DAW_USE_EXCEPTIONS )
+		// Overlong, surrogate, above U+10FFFF, invalid lead byte, truncated and
+		// lone continuation byte
+		for( char const *bad :
+		     { "\xC0\x80", "\xE0\x80\x80", "\xED\xA0\x80", "\xF4\x90\x80\x80",
+		       "\xFF", "\xE2\x82", "\x80" } ) {
+			auto bad_str = std::string( 140, 'a' );
+			bad_str.replace( pos, 1, bad );
+			bool has_error = false;
+			try {
+				(void)from_json<std::string>( "\"" + bad_str + "\"", flags );
+			} catch( json_exception const & ) { has_error = true; }
+			test_assert( has_error, "Expected an invalid string error" );
+		}
+#endif
+	}
+
+	// Text without ASCII is validated 64 bytes at a time by the wide exec modes.
+	// Sequences are cut by the block boundaries and the error is moved through
+	// the blocks
+	auto multibyte = std::string( );
+	for( std::size_t n = 0; n < 70; ++n ) {
+		multibyte += n % 3 == 0   ? "\xE6\x97\xA5"
+		             : n % 3 == 1 ? "\xC3\xA9"
+		                          : "\xF0\x9F\x98\x80";
+	}
+	test_assert( from_json<std::string>( "\"" + multibyte + "\"", flags ) ==
+	               multibyte,
+	             "Unexpected multibyte string" );
+#if defined( DAW_USE_EXCEPTIONS )
+	for( std::size_t pos = 0; pos < multibyte.size( ); ++pos ) {
+		if( ( static_cast<unsigned char>( multibyte[pos] ) & 0xC0U ) == 0x80U ) {
+			continue;
+		}
+		for( char const *bad : { "\xC0\x80", "\xED\xA0\x80", "\xF4\x90\x80\x80",
+		                         "\xE2\x82\"", "\x80" } ) {
+			auto bad_str = multibyte;
+			bad_str.insert( pos, bad );
+			bool has_error = false;
+			try {
+				(void)from_json<std::string>( "\"" + bad_str + "\"", flags );
+			} catch( json_exception const & ) { has_error = true; }
+			test_assert( has_error, "Expected an invalid string error" );
+		}
+	}
+#endif
+}
+
+int main( int, char ** )
+#if defined( DAW_USE_EXCEPTIONS )
+  try
+#endif
+{
+	using daw::json::options::CheckedParseMode;
+	using daw::json::options::ExecModeTypes;
+	test_validate_utf8<ExecModeTypes::compile_time, CheckedParseMode::yes>( );
+	test_validate_utf8<ExecModeTypes::runtime, CheckedParseMode::yes>( );
+	test_validate_utf8<ExecModeTypes::best_available, CheckedParseMode::yes>( );
+	test_validate_utf8<ExecModeTypes::best_available, CheckedParseMode::no>( );
+	std::cout << "done\n";
+}
+#if defined( DAW_USE_EXCEPTIONS )
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+}
+#endif
@@ -0,0 +1,330 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+// Benchmark member name lookup for a wide class whose members arrive in a
+// different order in every object, and in one order that differs from the
+// mapping with options::PredictMemberOrder.  The
+// options::MemberNameMatching::hash_linear_scan run is the baseline without
+// the lookup table
+
+#include "defines.h"
+
+#include <daw/json/daw_json_link.h>
+
+#include <daw/daw_benchmark.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#if not defined( DAW_NUM_RUNS )
+#if not defined( DEBUG ) or defined( NDEBUG )
+static inline constexpr std::size_t DAW_NUM_RUNS = 250;
+#else
+static inline constexpr std::size_t DAW_NUM_RUNS = 2;
+#endif
+#endif
+static_assert( DAW_NUM_RUNS > 0 );
+
+inline constexpr std::size_t member_count = 64;
+
+struct wide_class_t {
+	std::array<int, member_count> f;
+
+	template<typename... Ints>
+	explicit wide_class_t( Ints... values )
+	  : f{ values... } {}
+};
+
+namespace daw::json {
+	template<>
+	struct json_data_contract<wide_class_t> {
+		static constexpr char const f00[] = "event_field_00";
+		static constexpr char const f01[] = "event_field_01";
+		static constexpr char const f02[] = "event_field_02";
+		static constexpr char const f03[] = "event_field_03";
+		static constexpr char const f04[] = "event_field_04";
+		static constexpr char const f05[] = "event_field_05";
+		static constexpr char const f06[] = "event_field_06";
+		static constexpr char const f07[] = "event_field_07";
+		static constexpr char const f08[] = "event_field_08";
+		static constexpr char const f09[] = "event_field_09";
+		static constexpr char const f10[] = "event_field_10";
+		static constexpr char const f11[] = "event_field_11";
+		static constexpr char const f12[] = "event_field_12";
+		static constexpr char const f13[] = "event_field_13";
+		static constexpr char const f14[] = "event_field_14";
+		static constexpr char const f15[] = "event_field_15";
+		static constexpr char const f16[] = "event_field_16";
+		static constexpr char const f17[] = "event_field_17";
+		static constexpr char const f18[] = "event_field_18";
+		static constexpr char const f19[] = "event_field_19";
+		static constexpr char const f20[] = "event_field_20";
+		static constexpr char const f21[] = "event_field_21";
+		static constexpr char const f22[] = "event_field_22";
+		static constexpr char const f23[] = "event_field_23";
+		static constexpr char const f24[] = "event_field_24";
+		static constexpr char const f25[] = "event_field_25";
+		static constexpr char const f26[] = "event_field_26";
+		static constexpr char const f27[] = "event_field_27";
+		static constexpr char const f28[] = "event_field_28";
+		static constexpr char const f29[] = "event_field_29";
+		static constexpr char const f30[] = "event_field_30";
+		static constexpr char const f31[] = "event_field_31";
+		static constexpr char const f32[] = "event_field_32";
+		static constexpr char const f33[] = "event_field_33";
+		static constexpr char const f34[] = "event_field_34";
+		static constexpr char const f35[] = "event_field_35";
+		static constexpr char const f36[] = "event_field_36";
+		static constexpr char const f37[] = "event_field_37";
+		static constexpr char const f38[] = "event_field_38";
+		static constexpr char const f39[] = "event_field_39";
+		static constexpr char const f40[] = "event_field_40";
+		static constexpr char const f41[] = "event_field_41";
+		static constexpr char const f42[] = "event_field_42";
+		static constexpr char const f43[] = "event_field_43";
+		static constexpr char const f44[] = "event_field_44";
+		static constexpr char const f45[] = "event_field_45";
+		static constexpr char const f46[] = "event_field_46";
+		static constexpr char const f47[] = "event_field_47";
+		static constexpr char const f48[] = "event_field_48";
+		static constexpr char const f49[] = "event_field_49";
+		static constexpr char const f50[] = "event_field_50";
+		static constexpr char const f51[] = "event_field_51";
+		static constexpr char const f52[] = "event_field_52";
+		static constexpr char const f53[] = "event_field_53";
+		static constexpr char const f54[] = "event_field_54";
+		static constexpr char const f55[] = "event_field_55";
+		static constexpr char const f56[] = "event_field_56";
+		static constexpr char const f57[] = "event_field_57";
+		static constexpr char const f58[] = "event_field_58";
+		static constexpr char const f59[] = "event_field_59";
+		static constexpr char const f60[] = "event_field_60";
+		static constexpr char const f61[] = "event_field_61";
+		static constexpr char const f62[] = "event_field_62";
+		static constexpr char const f63[] = "event_field_63";
+
+		using type = json_member_list<
+		  json_number<f00, int>,
+		  json_number<f01, int>,
+		  json_number<f02, int>,
+		  json_number<f03, int>,
+		  json_number<f04, int>,
+		  json_number<f05, int>,
+		  json_number<f06, int>,
+		  json_number<f07, int>,
+		  json_number<f08, int>,
+		  json_number<f09, int>,
+		  json_number<f10, int>,
+		  json_number<f11, int>,
+		  json_number<f12, int>,
+		  json_number<f13, int>,
+		  json_number<f14, int>,
+		  json_number<f15, int>,
+		  json_number<f16, int>,
+		  json_number<f17, int>,
+		  json_number<f18, int>,
+		  json_number<f19, int>,
+		  json_number<f20, int>,
+		  json_number<f21, int>,
+		  json_number<f22, int>,
+		  json_number<f23, int>,
+		  json_number<f24, int>,
+		  json_number<f25, int>,
+		  json_number<f26, int>,
+		  json_number<f27, int>,
+		  json_number<f28, int>,
+		  json_number<f29, int>,
+		  json_number<f30, int>,
+		  json_number<f31, int>,
+		  json_number<f32, int>,
+		  json_number<f33, int>,
+		  json_number<f34, int>,
+		  json_number<f35, int>,
+		  json_number<f36, int>,
+		  json_number<f37, int>,
+		  json_number<f38, int>,
+		  json_number<f39, int>,
+		  json_number<f40, int>,
+		  json_number<f41, int>,
+		  json_number<f42, int>,
+		  json_number<f43, int>,
+		  json_number<f44, int>,
+		  json_number<f45, int>,
+		  json_number<f46, int>,
+		  json_number<f47, int>,
+		  json_number<f48, int>,
+		  json_number<f49, int>,
+		  json_number<f50, int>,
+		  json_number<f51, int>,
+		  json_number<f52, int>,
+		  json_number<f53, int>,
+		  json_number<f54, int>,
+		  json_number<f55, int>,
+		  json_number<f56, int>,
+		  json_number<f57, int>,
+		  json_number<f58, int>,
+		  json_number<f59, int>,
+		  json_number<f60, int>,
+		  json_number<f61, int>,
+		  json_number<f62, int>,
+		  json_number<f63, int>>;
+
+		static constexpr auto to_json_data( wide_class_t const &v ) {
+			return std::forward_as_tuple(
+			  v.f[0], v.f[1], v.f[2], v.f[3], v.f[4], v.f[5], v.f[6], v.f[7], v.f[8],
+			  v.f[9], v.f[10], v.f[11], v.f[12], v.f[13], v.f[14], v.f[15], v.f[16],
+			  v.f[17], v.f[18], v.f[19], v.f[20], v.f[21], v.f[22], v.f[23], v.f[24],
+			  v.f[25], v.f[26], v.f[27], v.f[28], v.f[29], v.f[30], v.f[31], v.f[32],
+			  v.f[33], v.f[34], v.f[35], v.f[36], v.f[37], v.f[38], v.f[39], v.f[40],
+			  v.f[41], v.f[42], v.f[43], v.f[44], v.f[45], v.f[46], v.f[47], v.f[48],
+			  v.f[49], v.f[50], v.f[51], v.f[52], v.f[53], v.f[54], v.f[55], v.f[56],
+			  v.f[57], v.f[58], v.f[59], v.f[60], v.f[61], v.f[62], v.f[63] );
+		}
+	};
+} // namespace daw::json
+
+std::string make_json_data( std::size_t count, bool stable_order ) {
+	auto rng = std::mt19937( 42 );
+	auto order = std::array<std::size_t, member_count>{ };
+	std::iota( order.begin( ), order.end( ), std::size_t{ 0 } );
+	std::shuffle( order.begin( ), order.end( ), rng );
+	std::string result = "[";
+	for( std::size_t n = 0; n < count; ++n ) {
+		if( not stable_order ) {
+			std::shuffle( order.begin( ), order.end( ), rng );
+		}
+		result += '{';
+		for( std::size_t m : order ) {
+			result += "\"event_field_";
+			result += static_cast<char>( '0' + m / 10 );
+			result += static_cast<char>( '0' + m % 10 );
+			result += "\":" + std::to_string( n + m ) + ',';
+		}
+		result.back( ) = '}';
+		result += ',';
+	}
+	result.back( ) = ']';
+	return result;
+}
+
+bool validate( std::vector<wide_class_t> const &values ) {
+	for( std::size_t n = 0; n < values.size( ); ++n ) {
+		for( std::size_t m = 0; m < member_count; ++m ) {
+			if( values[n].f[m] != static_cast<int>( n + m ) ) {
+				return false;
+			}
+		}
+	}
+	return true;
+}
+
+int main( int argc, char ** )
+#if defined( DAW_USE_EXCEPTIONS )
+  try
+#endif
+{
+	using namespace daw::json;
+	std::size_t const count = argc > 1 ? 100'000 : 1'000;
+	std::string const json_data = make_json_data( count, false );
+	auto const json_sv = std::string_view( json_data );
+	std::cout << "Processing " << json_sv.size( ) << " bytes "
+	          << daw::utility::to_bytes_per_second( json_sv.size( ) ) << '\n';
+
+	auto const result = *daw::bench_n_test_mbs<DAW_NUM_RUNS>(
+	  "wide class with shuffled members", json_sv.size( ),
+	  []( std::string_view sv ) {
+		  auto data = from_json<std::vector<wide_class_t>>( sv );
+		  daw::do_not_optimize( data );
+		  return data;
+	  },
+	  json_sv );
+	test_assert( result.size( ) == count, "Unexpected number of elements" );
+	test_assert( validate( result ), "Members were not matched correctly" );
+
+	auto const result_linear = *daw::bench_n_test_mbs<DAW_NUM_RUNS>(
+	  "wide class with shuffled members, linear scan", json_sv.size( ),
+	  []( std::string_view sv ) {
+		  auto data = from_json<std::vector<wide_class_t>>(
+		    sv, options::parse_flags<
+		          options::MemberNameMatching::hash_linear_scan> );
+		  daw::do_not_optimize( data );
+		  return data;
+	  },
+	  json_sv );
+	test_assert( validate( result_linear ),
+	             "Members were not matched correctly" );
+
+	auto const result_unchecked = *daw::bench_n_test_mbs<DAW_NUM_RUNS>(
+	  "wide class with shuffled members, unchecked", json_sv.size( ),
+	  []( std::string_view sv ) {
+		  auto data = from_json<std::vector<wide_class_t>>(
+		    sv, options::parse_flags<options::CheckedParseMode::no> );
+		  daw::do_not_optimize( data );
+		  return data;
+	  },
+	  json_sv );
+	test_assert( validate( result_unchecked ),
+	             "Members were not matched correctly" );
+
+	std::string const json_data_stable = make_json_data( count, true );
+	auto const json_sv_stable = std::string_view( json_data_stable );
+
+	auto const result_stable = *daw::bench_n_test_mbs<DAW_NUM_RUNS>(
+	  "wide class with stable member order", json_sv_stable.size( ),
+	  []( std::string_view sv ) {
+		  auto data = from_json<std::vector<wide_class_t>>( sv );
+		  daw::do_not_optimize( data );
+		  return data;
+	  },
+	  json_sv_stable );
+	test_assert( validate( result_stable ),
+	             "Members were not matched correctly" );
+
+	auto const result_predicted = *daw::bench_n_test_mbs<DAW_NUM_RUNS>(
+	  "wide class with stable member order, predicted", json_sv_stable.size( ),
+	  []( std::string_view sv ) {
+		  auto data = from_json<std::vector<wide_class_t>>(
+		    sv, options::parse_flags<options::PredictMemberOrder::yes> );
+		  daw::do_not_optimize( data );
+		  return data;
+	  },
+	  json_sv_stable );
+	test_assert( validate( result_predicted ),
+	             "Members were not matched correctly" );
+
+	auto const result_shuffled_predicted = *daw::bench_n_test_mbs<DAW_NUM_RUNS>(
+	  "wide class with shuffled members, predicted", json_sv.size( ),
+	  []( std::string_view sv ) {
+		  auto data = from_json<std::vector<wide_class_t>>(
+		    sv, options::parse_flags<options::PredictMemberOrder::yes> );
+		  daw::do_not_optimize( data );
+		  return data;
+	  },
+	  json_sv );
+	test_assert( validate( result_shuffled_predicted ),
+	             "Members were not matched correctly" );
+}
+#if defined( DAW_USE_EXCEPTIONS )
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+} catch( std::exception const &ex ) {
+	std::cerr << "Unknown exception thrown during testing: " << ex.what( )
+	          << '\n';
+	exit( 1 );
+} catch( ... ) {
+	std::cerr << "Unknown exception thrown during testing\n";
+	throw;
+}
+#endif